@@ -1,7 +1,62 @@
+newoption {
+	trigger = "fma",
+	description = "Emit hardware fused multiply-add instructions (requires an FMA3-capable CPU)"
+}
+
+newoption {
+	trigger = "no-fma",
+	description = "Never fuse multiply-adds, for results bit-exact with unfused builds"
+}
+
+newoption {
+	trigger = "simd",
+	value = "ISA",
+	description = "Instruction set for the SIMD kernels",
+	allowed = {
+		{ "sse2", "SSE2 (x86-64 baseline)" },
+		{ "avx2", "AVX2" }
+	},
+	default = "sse2"
+}
+
+newoption {
+	trigger = "instrument",
+	description = "Count Vector constructions, copies, square roots, and divisions (see vector/counters.hh)"
+}
+
+newoption {
+	trigger = "sanitize",
+	value = "SANITIZER",
+	description = "Build with a sanitizer, e.g. to run the threaded tests under ThreadSanitizer",
+	allowed = {
+		{ "address", "AddressSanitizer" },
+		{ "thread", "ThreadSanitizer" },
+		{ "undefined", "UndefinedBehaviorSanitizer" }
+	}
+}
+
 workspace "libtransform"
 	architecture "x86_64"
 	configurations { "debug", "release" }
 
+	filter "options:fma"
+		isaextensions { "FMA" }
+
+	filter "options:no-fma"
+		defines { "TRANSFORM_NO_FMA" }
+
+	filter "options:instrument"
+		defines { "TRANSFORM_INSTRUMENT" }
+
+	filter "options:simd=avx2"
+		vectorextensions "AVX2"
+
+	filter "options:sanitize=*"
+		buildoptions { "-fsanitize=%{_OPTIONS['sanitize']}", "-fno-omit-frame-pointer" }
+		linkoptions { "-fsanitize=%{_OPTIONS['sanitize']}" }
+
+	filter {}
+
 project "transform"
 	language "C++"
 	cppdialect "C++17"
@@ -43,6 +98,42 @@ project "test"
 		"src/"
 	}
 
+	links { "transform" }
+
+	filter "system:linux"
+		links { "pthread" }
+
+	filter "configurations:debug*"
+		defines { "DEBUG" }
+		symbols "On"
+
+	filter "configurations:release*"
+		defines { "NDEBUG" }
+		optimize "On"
+
+project "bench"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+
+	targetdir "bin/%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}/%{prj.name}"
+	objdir  "build/%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}/%{prj.name}"
+
+	files {
+		"src/%{prj.name}/**.cc"
+	}
+
+	includedirs {
+		"src/"
+	}
+
+	defines { "CATCH_CONFIG_ENABLE_BENCHMARKING" }
+
+	links { "transform" }
+
+	filter "system:linux"
+		links { "pthread" }
+
 	filter "configurations:debug*"
 		defines { "DEBUG" }
 		symbols "On"
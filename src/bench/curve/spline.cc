@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+#include "transform/curve.hh"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE( "[Spline] 10000 entities on their own Catmull-Rom paths", "[Spline]" )
+{
+	const size_t count = 10000;
+	std::vector<transform::Vector3f> points(count * 4);
+	for (size_t i = 0; i < points.size(); i++) {
+		points[i] = transform::Vector3f(i * 0.25f, std::sin(i * 0.3f), std::cos(i * 0.7f));
+	}
+	std::vector<transform::Spline3f> curves;
+	for (size_t c = 0; c < count; c++) { curves.push_back(transform::Spline3f::catmull_rom(&points[c * 4], 4)); }
+	const transform::Splines<3> batch(curves.data(), count);
+	std::vector<transform::Vector3f> out(count);
+	const float t = 0.37f;
+
+	BENCHMARK( "by hand with vector operators" ) {
+		// the middle segment, from the Catmull-Rom matrix
+		const float u = t * 3 - 1, u2 = u * u, u3 = u2 * u;
+		for (size_t c = 0; c < count; c++) {
+			transform::Vector3f p0 = points[c * 4], p1 = points[c * 4 + 1], p2 = points[c * 4 + 2], p3 = points[c * 4 + 3];
+			out[c] = (p1 * 2.0f + (p2 - p0) * u + (p0 * 2.0f - p1 * 5.0f + p2 * 4.0f - p3) * u2
+				+ (p1 * 3.0f - p0 - p2 * 3.0f + p3) * u3) * 0.5f;
+		}
+		return out[count - 1].x;
+	};
+
+	BENCHMARK( "Spline::evaluate per curve" ) {
+		for (size_t c = 0; c < count; c++) { out[c] = curves[c].evaluate(t); }
+		return out[count - 1].x;
+	};
+
+	BENCHMARK( "Splines::evaluate" ) {
+		batch.evaluate(t, out.data());
+		return out[count - 1].x;
+	};
+}
+
+TEST_CASE( "[Spline] Tessellating one curve into 100001 points", "[Spline]" )
+{
+	std::vector<transform::Vector3f> p(11);
+	for (int i = 0; i < 11; i++) { p[i] = transform::Vector3f(i, std::sin(i * 0.8f), std::cos(i * 0.5f)); }
+	const transform::Spline3f curve = transform::Spline3f::catmull_rom(p.data(), 11);
+	const size_t steps = 10000, n = curve.segments() * steps + 1;
+	std::vector<transform::Vector<3, float>> out(n);
+
+	BENCHMARK( "Horner at each parameter" ) {
+		for (size_t i = 0; i < n; i++) { out[i] = curve.evaluate((float) i / (n - 1)); }
+		return out[n - 1][0];
+	};
+
+	BENCHMARK( "forward differencing" ) {
+		curve.tessellate(steps, out.data());
+		return out[n - 1][0];
+	};
+}
@@ -0,0 +1,53 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE( "[Coordinates] 1000000 Vector3f to spherical and back", "[Coordinates]" )
+{
+	const size_t n = 1000000;
+	std::vector<transform::Vector3f> points(n), out(n);
+	for (size_t i = 0; i < n; i++) {
+		points[i] = transform::Vector3f(std::sin(i * 0.9f), std::cos(i * 0.4f), std::sin(i * 0.2f));
+	}
+
+	BENCHMARK( "libm" ) {
+		for (size_t i = 0; i < n; i++) {
+			float x = points[i].x, y = points[i].y, z = points[i].z;
+			float r = std::sqrt(x * x + y * y + z * z);
+			float theta = std::atan2(std::sqrt(x * x + y * y), z), phi = std::atan2(y, x);
+			out[i] = transform::Vector3f(
+				r * std::sin(theta) * std::cos(phi), r * std::sin(theta) * std::sin(phi), r * std::cos(theta)
+			);
+		}
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "FAST" ) {
+		transform::coordinates::to_spherical(points.data(), out.data(), n, transform::FAST);
+		transform::coordinates::from_spherical(out.data(), out.data(), n, transform::FAST);
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "MEDIUM" ) {
+		transform::coordinates::to_spherical(points.data(), out.data(), n, transform::MEDIUM);
+		transform::coordinates::from_spherical(out.data(), out.data(), n, transform::MEDIUM);
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "PRECISE" ) {
+		transform::coordinates::to_spherical(points.data(), out.data(), n, transform::PRECISE);
+		transform::coordinates::from_spherical(out.data(), out.data(), n, transform::PRECISE);
+		return out[n - 1].z;
+	};
+
+	std::vector<float> x(n), y(n), z(n), a(n), b(n), c(n);
+	for (size_t i = 0; i < n; i++) { x[i] = points[i].x; y[i] = points[i].y; z[i] = points[i].z; }
+
+	BENCHMARK( "MEDIUM, component arrays" ) {
+		transform::coordinates::to_spherical(x.data(), y.data(), z.data(), a.data(), b.data(), c.data(), n);
+		transform::coordinates::from_spherical(a.data(), b.data(), c.data(), a.data(), b.data(), c.data(), n);
+		return c[n - 1];
+	};
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+// Moller-Trumbore one triangle at a time with Vector3::cross and Vector::dot, as callers did before.
+static int scalar_closest(const transform::Vector3f& o, const transform::Vector3f& d, const std::vector<transform::Vector3f>& v, float& best)
+{
+	int index = -1;
+	best = INFINITY;
+	for (size_t i = 0; i < v.size(); i += 3) {
+		transform::Vector3f e1 = transform::Vector3f(v[i + 1] - v[i]);
+		transform::Vector3f e2 = transform::Vector3f(v[i + 2] - v[i]);
+		transform::Vector3f p = d.cross(e2);
+		float det = e1.dot(p);
+		if (det == 0) { continue; }
+		float inv = 1 / det;
+		transform::Vector3f s = transform::Vector3f(o - v[i]);
+		float u = s.dot(p) * inv;
+		if (u < 0 || u > 1) { continue; }
+		transform::Vector3f q = s.cross(e1);
+		float w = d.dot(q) * inv;
+		if (w < 0 || u + w > 1) { continue; }
+		float t = e2.dot(q) * inv;
+		if (t > 0 && t < best) { best = t; index = (int) (i / 3); }
+	}
+	return index;
+}
+
+// Throughput in rays per second is 1024 divided by the reported time.
+TEST_CASE( "[Intersect] 1024 rays against 4096 triangles", "[Intersect]" )
+{
+	const int nt = 4096, nr = 1024;
+	std::vector<transform::Vector3f> vertices;
+	transform::Triangles triangles;
+	for (int i = 0; i < nt; i++) {
+		float x = (i % 64) / 16.0f, y = (i / 64) / 16.0f, z = 1 + 0.5f * std::sin(i * 0.1f);
+		transform::Vector3f a = transform::Vector3f(x, y, z);
+		transform::Vector3f b = transform::Vector3f(x + 0.1f, y, z);
+		transform::Vector3f c = transform::Vector3f(x, y + 0.1f, z + 0.05f);
+		vertices.push_back(a);
+		vertices.push_back(b);
+		vertices.push_back(c);
+		triangles.add(a, b, c);
+	}
+
+	std::vector<transform::Vector3f> origins, directions;
+	for (int r = 0; r < nr; r++) {
+		origins.push_back(transform::Vector3f((r % 32) / 8.0f, (r / 32) / 8.0f, -1));
+		directions.push_back(transform::Vector3f(0.01f, 0.02f, 1));
+	}
+
+	BENCHMARK( "scalar, one triangle at a time" ) {
+		float t, sum = 0;
+		for (int r = 0; r < nr; r++) { sum += scalar_closest(origins[r], directions[r], vertices, t); }
+		return sum;
+	};
+
+	BENCHMARK( "one ray against a register of triangles" ) {
+		int sum = 0;
+		transform::Hit hit;
+		for (int r = 0; r < nr; r++) {
+			transform::intersect(origins[r], directions[r], triangles, hit);
+			sum += hit.index;
+		}
+		return sum;
+	};
+
+	BENCHMARK_ADVANCED( "a register of rays against one triangle" )(Catch::Benchmark::Chronometer meter) {
+		transform::Rays rays;
+		for (int r = 0; r < nr; r++) { rays.add(origins[r], directions[r]); }
+		std::vector<transform::Rays> batches(meter.runs(), rays);
+		meter.measure([&](int i) {
+			transform::intersect(batches[i], triangles);
+			return batches[i].index[0];
+		});
+	};
+}
@@ -0,0 +1,29 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE( "[PCA] 100000 neighbourhoods of 16 points", "[PCA]" )
+{
+	const size_t sets = 100000, k = 16;
+	std::vector<transform::Vector<3, float>> points(sets * k);
+	std::vector<size_t> offsets(sets + 1);
+	for (size_t i = 0; i < points.size(); i++) {
+		points[i][0] = std::sin(i * 0.37f);
+		points[i][1] = std::cos(i * 0.11f);
+		points[i][2] = 0.1f * std::sin(i * 0.05f);
+	}
+	for (size_t i = 0; i <= sets; i++) { offsets[i] = i * k; }
+	std::vector<transform::Principal> out(sets);
+
+	BENCHMARK( "one set at a time" ) {
+		for (size_t i = 0; i < sets; i++) { transform::pca(&points[i * k], k, out[i]); }
+		return out[0].values[0];
+	};
+
+	BENCHMARK( "batched" ) {
+		transform::pca(points.data(), offsets.data(), sets, out.data());
+		return out[0].values[0];
+	};
+}
@@ -0,0 +1,33 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE( "[Positions] Rebasing 1000000 positions to the camera", "[Positions]" )
+{
+	const size_t n = 1000000;
+	std::vector<transform::Vector3d> points(n);
+	for (size_t i = 0; i < n; i++) {
+		points[i] = transform::Vector3d(1.0e7 + 1000 * std::sin(i * 0.01), -2.5e6 + 1000 * std::cos(i * 0.013), 0.001 * i);
+	}
+	const transform::Positions positions(points.data(), n);
+	const transform::Vector3d camera(1.0e7, -2.5e6, 10);
+	std::vector<transform::Vector3f> out(n);
+	std::vector<float> x(n), y(n), z(n);
+
+	BENCHMARK( "Vector3d to Vector3f" ) {
+		transform::rebase(points.data(), n, camera, out.data());
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "Positions to Vector3f" ) {
+		transform::rebase(positions, camera, out.data());
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "Positions to component arrays" ) {
+		transform::rebase(positions, camera, x.data(), y.data(), z.data());
+		return z[n - 1];
+	};
+}
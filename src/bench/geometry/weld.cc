@@ -0,0 +1,49 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Each iteration takes about a second; run with --benchmark-samples 10 or so.
+TEST_CASE( "[Weld] 10000000 triangle soup vertices", "[Weld]" )
+{
+	// six corners of the two triangles of each quad of a 1291 x 1291 grid, with float noise from
+	// recomputing them
+	const size_t side = 1291, n = 10000000;
+	std::vector<transform::Vector<3, float>> soup(n), out(n);
+	std::vector<uint32_t> remap(n);
+	const int corners[6][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 0 }, { 1, 1 }, { 0, 1 } };
+	for (size_t i = 0; i < n; i++) {
+		size_t quad = (i / 6) % ((side - 1) * (side - 1));
+		size_t x = quad % (side - 1) + corners[i % 6][0], y = quad / (side - 1) + corners[i % 6][1];
+		float u = x * 0.1f, v = y * 0.1f;
+		soup[i] = transform::Vector<3, float>();
+		soup[i][0] = u;
+		soup[i][1] = 0.5f * std::sin(u * 0.3f) * std::cos(v * 0.2f);
+		soup[i][2] = v;
+	}
+
+	BENCHMARK( "std::unordered_map of quantized positions" ) {
+		std::unordered_map<transform::Vector<3, int>, uint32_t> cells;
+		cells.reserve(n / 4);
+		size_t count = 0;
+		for (size_t i = 0; i < n; i++) {
+			transform::Vector<3, int> key;
+			for (int k = 0; k < 3; k++) { key[k] = (int) std::floor(soup[i][k] * 1e4f + 0.5f); }
+			auto found = cells.emplace(key, (uint32_t) count);
+			if (found.second) { out[count++] = soup[i]; }
+			remap[i] = found.first->second;
+		}
+		return count;
+	};
+
+	BENCHMARK( "weld, one thread" ) {
+		return transform::weld(soup.data(), n, 1e-4f, out.data(), remap.data(), 1);
+	};
+
+	BENCHMARK( "weld, all threads" ) {
+		return transform::weld(soup.data(), n, 1e-4f, out.data(), remap.data(), std::thread::hardware_concurrency());
+	};
+}
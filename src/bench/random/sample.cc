@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+#include "transform/random.hh"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST_CASE( "[Sample] 1000000 unit sphere directions", "[Sample]" )
+{
+	const size_t n = 1000000;
+	std::vector<transform::Vector3f> out(n);
+	std::vector<float> x(n), y(n), z(n);
+
+	BENCHMARK( "std::mt19937 with std::sin and std::cos" ) {
+		std::mt19937 engine(1);
+		std::uniform_real_distribution<float> u(0.0f, 1.0f);
+		for (size_t i = 0; i < n; i++) {
+			float h = 1 - 2 * u(engine), phi = 6.28318531f * u(engine);
+			float rho = std::sqrt(std::fmax(0.0f, 1 - h * h));
+			out[i] = transform::Vector3f(rho * std::cos(phi), rho * std::sin(phi), h);
+		}
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "sample::sphere into Vector3f" ) {
+		transform::Random rng(1);
+		transform::sample::sphere(rng, out.data(), n);
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "sample::sphere into arrays" ) {
+		transform::Random rng(1);
+		transform::sample::sphere(rng, x.data(), y.data(), z.data(), n);
+		return z[n - 1];
+	};
+}
+
+TEST_CASE( "[Sample] 1000000 points in a box", "[Sample]" )
+{
+	const size_t n = 1000000;
+	const transform::Vector3f lo(-1, -1, -1), hi(1, 1, 1);
+	std::vector<transform::Vector3f> out(n);
+
+	BENCHMARK( "std::mt19937" ) {
+		std::mt19937 engine(1);
+		std::uniform_real_distribution<float> u(-1.0f, 1.0f);
+		for (size_t i = 0; i < n; i++) { out[i] = transform::Vector3f(u(engine), u(engine), u(engine)); }
+		return out[n - 1].z;
+	};
+
+	BENCHMARK( "sample::box" ) {
+		transform::Random rng(1);
+		transform::sample::box(rng, lo, hi, out.data(), n);
+		return out[n - 1].z;
+	};
+}
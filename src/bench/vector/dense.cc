@@ -0,0 +1,58 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// The single-accumulator loop Vector::dot used before the dense kernels.
+static float scalar_dot(const float* a, const float* b, size_t n)
+{
+	float result = 0;
+	for (size_t i = 0; i < n; i++) { result += a[i] * b[i]; }
+	return result;
+}
+
+static size_t scalar_topk(const float* q, const float* rows, size_t count, size_t dim, size_t k, transform::dense::Match* out)
+{
+	std::vector<transform::dense::Match> all(count);
+	float qn = std::sqrt(scalar_dot(q, q, dim));
+	for (size_t r = 0; r < count; r++) {
+		const float* row = rows + r * dim;
+		all[r] = { r, scalar_dot(q, row, dim) / (qn * std::sqrt(scalar_dot(row, row, dim))) };
+	}
+	k = std::min(k, count);
+	std::partial_sort(all.begin(), all.begin() + k, all.end(),
+		[](const transform::dense::Match& a, const transform::dense::Match& b) { return a.score > b.score; });
+	std::copy(all.begin(), all.begin() + k, out);
+	return k;
+}
+
+TEST_CASE( "[Dense] dot product of Vector<N, float>", "[Dense]" )
+{
+	transform::Vector<512, float> a, b;
+	for (int i = 0; i < 512; i++) {
+		a[i] = std::sin(i * 0.37f);
+		b[i] = std::cos(i * 0.11f);
+	}
+
+	BENCHMARK( "scalar, N = 512" ) { return scalar_dot(a.ptr(), b.ptr(), 512); };
+	BENCHMARK( "dense, N = 512" ) { return a.dot(b); };
+}
+
+TEST_CASE( "[Dense] top-10 cosine search over 100000 x 256", "[Dense]" )
+{
+	const size_t count = 100000, dim = 256;
+	std::vector<float> rows(count * dim), query(dim);
+	for (size_t i = 0; i < rows.size(); i++) { rows[i] = std::sin(i * 0.0137f); }
+	for (size_t i = 0; i < dim; i++) { query[i] = std::cos(i * 0.7f); }
+	transform::dense::Match out[10];
+
+	BENCHMARK( "scalar" ) { return scalar_topk(query.data(), rows.data(), count, dim, 10, out); };
+	BENCHMARK( "dense, 1 thread" ) {
+		return transform::dense::topk(query.data(), rows.data(), count, dim, 10, out);
+	};
+	BENCHMARK( "dense, 4 threads" ) {
+		return transform::dense::topk(query.data(), rows.data(), count, dim, 10, out, transform::dense::COSINE, 4);
+	};
+}
@@ -0,0 +1,24 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+#include <vector>
+
+// Swizzles should cost the same as the element-wise converting constructors they replace;
+// with -O2 both reduce to plain loads and stores (check with `objdump -d`).
+TEST_CASE( "[Swizzle] Vector4f to Vector3f over 100000 vectors", "[Swizzle]" )
+{
+	const size_t n = 100000;
+	std::vector<transform::Vector4f> in(n);
+	std::vector<transform::Vector3f> out(n);
+	for (size_t i = 0; i < n; i++) { in[i].set(i, i + 1, i + 2, i + 3); }
+
+	BENCHMARK( "by hand" ) {
+		for (size_t i = 0; i < n; i++) { out[i] = transform::Vector3f(in[i].x, in[i].z, in[i].y); }
+		return out[n - 1].x;
+	};
+
+	BENCHMARK( "swizzle" ) {
+		for (size_t i = 0; i < n; i++) { out[i] = in[i].xzy(); }
+		return out[n - 1].x;
+	};
+}
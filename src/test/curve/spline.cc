@@ -0,0 +1,244 @@
+#include <catch2/catch.hpp>
+#include "transform/curve.hh"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO( "[Spline] Curve types interpolate their control points.", "[Spline]" )
+{
+	GIVEN( "A two-segment Bezier curve." )
+	{
+		const transform::Vector3f p[7] = {
+			transform::Vector3f(0, 0, 0), transform::Vector3f(1, 2, 0), transform::Vector3f(3, 2, 1),
+			transform::Vector3f(4, 0, 1), transform::Vector3f(5, -2, 1), transform::Vector3f(7, -1, 0),
+			transform::Vector3f(8, 0, 0)
+		};
+		transform::Spline3f bezier = transform::Spline3f::bezier(p, 7);
+
+		THEN( "it passes through the segment end points and hits the de Casteljau midpoint" ) {
+			REQUIRE( bezier.segments() == 2 );
+			for (int k = 0; k < 3; k++) {
+				REQUIRE( bezier.evaluate(0.0f)[k] == Approx( p[0][k] ) );
+				REQUIRE( bezier.evaluate(0.5f)[k] == Approx( p[3][k] ) );
+				REQUIRE( bezier.evaluate(1.0f)[k] == Approx( p[6][k] ) );
+				float mid = (p[0][k] + 3 * p[1][k] + 3 * p[2][k] + p[3][k]) / 8;
+				REQUIRE( bezier.evaluate(0.25f)[k] == Approx( mid ).margin(1e-6) );
+			}
+		}
+
+		THEN( "its derivative at the start is three times the first leg, per unit of t" ) {
+			transform::Vector3f d = bezier.derivative(0.0f);
+			for (int k = 0; k < 3; k++) { REQUIRE( d[k] == Approx( 3 * (p[1][k] - p[0][k]) * 2 ) ); }
+		}
+	}
+
+	GIVEN( "Five points for a Catmull-Rom curve, in double precision." )
+	{
+		const transform::Vector2d p[5] = {
+			transform::Vector2d(0, 0), transform::Vector2d(1, 1), transform::Vector2d(2, 0),
+			transform::Vector2d(3, -1), transform::Vector2d(5, 0)
+		};
+		transform::Spline2d curve = transform::Spline2d::catmull_rom(p, 5);
+
+		THEN( "it passes through every point with central-difference tangents" ) {
+			for (int i = 0; i < 5; i++) {
+				transform::Vector2d q = curve.evaluate(i / 4.0);
+				for (int k = 0; k < 2; k++) { REQUIRE( q[k] == Approx( p[i][k] ) ); }
+			}
+			transform::Vector2d d = curve.derivative(0.5);
+			for (int k = 0; k < 2; k++) { REQUIRE( d[k] == Approx( (p[3][k] - p[1][k]) / 2 * 4 ) ); }
+		}
+	}
+
+	GIVEN( "A Hermite curve with given tangents." )
+	{
+		const transform::Vector3f p[2] = { transform::Vector3f(0, 0, 0), transform::Vector3f(1, 0, 0) };
+		const transform::Vector3f m[2] = { transform::Vector3f(0, 1, 0), transform::Vector3f(0, -1, 0) };
+		transform::Spline3f curve = transform::Spline3f::hermite(p, m, 2);
+
+		THEN( "its end points and end tangents match" ) {
+			for (int k = 0; k < 3; k++) {
+				REQUIRE( curve.evaluate(0.0f)[k] == Approx( p[0][k] ) );
+				REQUIRE( curve.evaluate(1.0f)[k] == Approx( p[1][k] ) );
+				REQUIRE( curve.derivative(0.0f)[k] == Approx( m[0][k] ) );
+				REQUIRE( curve.derivative(1.0f)[k] == Approx( m[1][k] ) );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Spline] Batched evaluation matches single evaluation.", "[Spline]" )
+{
+	GIVEN( "A Catmull-Rom curve through nine points." )
+	{
+		std::vector<transform::Vector3f> p(9);
+		for (int i = 0; i < 9; i++) { p[i] = transform::Vector3f(i, std::sin(i * 0.8f), std::cos(i * 0.5f)); }
+		transform::Spline3f curve = transform::Spline3f::catmull_rom(p.data(), 9);
+
+		WHEN( "it is tessellated by forward differencing" ) {
+			const size_t steps = 50, n = curve.segments() * steps + 1;
+			std::vector<transform::Vector3f> points(n);
+			curve.tessellate(steps, points.data());
+
+			THEN( "every point matches Horner evaluation at the same parameter" ) {
+				for (size_t i = 0; i < n; i++) {
+					transform::Vector3f q = curve.evaluate((float) i / (n - 1));
+					for (int k = 0; k < 3; k++) { REQUIRE( points[i][k] == Approx( q[k] ).margin(1e-5) ); }
+				}
+			}
+		}
+
+		WHEN( "many parameters are evaluated at once" ) {
+			std::vector<float> t(101);
+			std::vector<transform::Vector<3, float>> points(101);
+			for (size_t i = 0; i < t.size(); i++) { t[i] = i / 100.0f; }
+			curve.evaluate(t.data(), t.size(), points.data());
+
+			THEN( "they match one at a time" ) {
+				for (size_t i = 0; i < t.size(); i++) {
+					bool equal = (points[i] == curve.evaluate(t[i]));
+					REQUIRE( equal );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Spline] Arc-length tables give constant-speed traversal.", "[Spline]" )
+{
+	GIVEN( "A straight Bezier segment with bunched control points, so t does not advance at constant speed." )
+	{
+		const transform::Vector2f p[4] = {
+			transform::Vector2f(0, 0), transform::Vector2f(0.1f, 0), transform::Vector2f(0.2f, 0), transform::Vector2f(10, 0)
+		};
+		transform::Spline2f line = transform::Spline2f::bezier(p, 4);
+
+		THEN( "its length is the distance between the end points" ) {
+			REQUIRE( line.length() == Approx( 10.0f ) );
+		}
+
+		WHEN( "points are placed at even distances" ) {
+			std::vector<float> s(21);
+			std::vector<transform::Vector2f> points(21);
+			for (size_t i = 0; i < s.size(); i++) { s[i] = i * 0.5f; }
+			line.travel(s.data(), s.size(), points.data());
+
+			THEN( "they are evenly spaced, although evenly spaced t would not be" ) {
+				for (size_t i = 0; i < s.size(); i++) { REQUIRE( points[i].x == Approx( s[i] ).margin(0.01) ); }
+				REQUIRE( line.evaluate(0.5f).x < 3.0f );
+			}
+		}
+
+		WHEN( "the table is rebuilt at a higher resolution" ) {
+			line.measure(256);
+
+			THEN( "the middle of the curve is found more closely" ) {
+				REQUIRE( line.evaluate(line.parameter(5.0f)).x == Approx( 5.0f ).margin(1e-3) );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Spline] Batches of splines evaluate a SIMD register of curves at a time.", "[Spline]" )
+{
+	GIVEN( "Thirty-seven three-segment curves, not a multiple of any SIMD width." )
+	{
+		const size_t count = 37;
+		std::vector<transform::Spline3f> curves;
+		for (size_t c = 0; c < count; c++) {
+			transform::Vector3f p[4];
+			for (int i = 0; i < 4; i++) { p[i] = transform::Vector3f(c + i, std::sin(c * 0.3f + i), i * 0.5f); }
+			curves.push_back(transform::Spline3f::catmull_rom(p, 4));
+		}
+		transform::Splines<3> batch(curves.data(), count);
+
+		WHEN( "every curve is evaluated at one parameter" ) {
+			std::vector<transform::Vector3f> out(count);
+			batch.evaluate(0.61f, out.data());
+
+			THEN( "each matches the curve on its own" ) {
+				for (size_t c = 0; c < count; c++) {
+					transform::Vector3f q = curves[c].evaluate(0.61f);
+					for (int k = 0; k < 3; k++) { REQUIRE( out[c][k] == Approx( q[k] ).margin(1e-6) ); }
+				}
+			}
+		}
+
+		WHEN( "each curve is evaluated at its own parameter" ) {
+			std::vector<float> t(count), x(count), y(count), z(count);
+			for (size_t c = 0; c < count; c++) { t[c] = (c * 7 % 37) / 36.0f; }
+			float* out[3] = { x.data(), y.data(), z.data() };
+			batch.evaluate(t.data(), out);
+
+			THEN( "each matches the curve on its own" ) {
+				for (size_t c = 0; c < count; c++) {
+					transform::Vector3f q = curves[c].evaluate(t[c]);
+					REQUIRE( x[c] == Approx( q.x ).margin(1e-6) );
+					REQUIRE( y[c] == Approx( q.y ).margin(1e-6) );
+					REQUIRE( z[c] == Approx( q.z ).margin(1e-6) );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Spline] Empty curves and batches evaluate safely.", "[Spline]" )
+{
+	GIVEN( "A default-constructed curve, an empty batch, and a batch of curves with no segments." )
+	{
+		transform::Spline3f empty;
+		transform::Splines<3> none;
+		std::vector<transform::Spline3f> hollow(5);
+		transform::Splines<3> flat(hollow.data(), hollow.size());
+
+		WHEN( "they are evaluated" ) {
+			transform::Vector3f p = empty.evaluate(0.5f), d = empty.derivative(0.5f);
+			transform::Vector3f points[3];
+			empty.tessellate(4, points);
+			transform::Vector3f q[5];
+			none.evaluate(0.5f, q);
+			flat.evaluate(0.5f, q);
+
+			THEN( "everything is zero and nothing is read past the end" ) {
+				REQUIRE( empty.segments() == 0 );
+				REQUIRE( empty.length() == 0.0f );
+				REQUIRE( empty.parameter(1.0f) == 1.0f );
+				bool zero = (p == transform::Vector3f(0, 0, 0)) && (d == transform::Vector3f(0, 0, 0));
+				REQUIRE( zero );
+				REQUIRE( points[0].x == 0.0f );
+				for (int i = 0; i < 5; i++) { REQUIRE( q[i].length2() == 0.0f ); }
+			}
+		}
+	}
+}
+
+SCENARIO( "[Spline] Bad point counts and mismatched batches are rejected.", "[Spline]" )
+{
+	GIVEN( "Seven control points." )
+	{
+		transform::Vector3f p[7];
+		for (int i = 0; i < 7; i++) { p[i] = transform::Vector3f(i, i * i, 0); }
+
+		WHEN( "curves are built from too few points, or a Bezier count that is not 3 * segments + 1" ) {
+			THEN( "each factory throws, in every build" ) {
+				REQUIRE_THROWS_AS( transform::Spline3f::bezier(p, 0), std::invalid_argument );
+				REQUIRE_THROWS_AS( transform::Spline3f::bezier(p, 3), std::invalid_argument );
+				REQUIRE_THROWS_AS( transform::Spline3f::bezier(p, 6), std::invalid_argument );
+				REQUIRE_THROWS_AS( transform::Spline3f::hermite(p, p, 1), std::invalid_argument );
+				REQUIRE_THROWS_AS( transform::Spline3f::catmull_rom(p, 0), std::invalid_argument );
+				REQUIRE_NOTHROW( transform::Spline3f::bezier(p, 7) );
+			}
+		}
+
+		WHEN( "a batch is built from curves with different segment counts, in either order" ) {
+			std::vector<transform::Spline3f> longer = { transform::Spline3f::catmull_rom(p, 7), transform::Spline3f::catmull_rom(p, 2) };
+			std::vector<transform::Spline3f> shorter = { longer[1], longer[0] };
+
+			THEN( "it throws" ) {
+				REQUIRE_THROWS_AS( transform::Splines<3>(longer.data(), 2), std::invalid_argument );
+				REQUIRE_THROWS_AS( transform::Splines<3>(shorter.data(), 2), std::invalid_argument );
+			}
+		}
+	}
+}
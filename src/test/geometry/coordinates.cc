@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO( "[Coordinates] Polar conversions match libm and round trip.", "[Coordinates]" )
+{
+	GIVEN( "Vector2 points around the origin, including the origin itself." )
+	{
+		const size_t n = 1001;
+		std::vector<transform::Vector2f> points(n), polar(n), back(n);
+		for (size_t i = 0; i < n; i++) {
+			points[i] = transform::Vector2f(std::cos(i * 0.7f) * (i % 13 + 1), std::sin(i * 0.3f) * (i % 7 + 1));
+		}
+		points[0] = transform::Vector2f(0, 0);
+
+		WHEN( "they are converted to polar at MEDIUM accuracy" ) {
+			transform::coordinates::to_polar(points.data(), polar.data(), n);
+
+			THEN( "radius and angle are within the documented bounds of libm" ) {
+				for (size_t i = 0; i < n; i++) {
+					double x = points[i].x, y = points[i].y;
+					REQUIRE( polar[i][0] == Approx( std::hypot(x, y) ).epsilon(1e-6) );
+					REQUIRE( polar[i][1] == Approx( std::atan2(y, x) ).margin(3e-6) );
+				}
+				REQUIRE( polar[0][1] == 0.0f );
+			}
+
+			THEN( "converting back in place restores the points" ) {
+				back = polar;
+				transform::coordinates::from_polar(back.data(), back.data(), n);
+				for (size_t i = 0; i < n; i++) {
+					for (int k = 0; k < 2; k++) { REQUIRE( back[i][k] == Approx( points[i][k] ).margin(3e-5) ); }
+				}
+			}
+		}
+
+		WHEN( "they are converted at FAST accuracy" ) {
+			transform::coordinates::to_polar(points.data(), polar.data(), n, transform::FAST);
+
+			THEN( "angles are within the FAST bound" ) {
+				for (size_t i = 0; i < n; i++) {
+					REQUIRE( polar[i][1] == Approx( std::atan2((double) points[i].y, (double) points[i].x) ).margin(7e-4) );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Coordinates] Spherical and cylindrical conversions match libm and round trip.", "[Coordinates]" )
+{
+	GIVEN( "Vector3 points, including the poles and the origin." )
+	{
+		const size_t n = 1003;
+		std::vector<transform::Vector3f> points(n), out(n), back(n);
+		for (size_t i = 0; i < n; i++) {
+			points[i] = transform::Vector3f(std::sin(i * 0.9f) * 3, std::cos(i * 0.4f) * 2, std::sin(i * 0.2f) * (i % 5));
+		}
+		points[0] = transform::Vector3f(0, 0, 0);
+		points[1] = transform::Vector3f(0, 0, 2);
+		points[2] = transform::Vector3f(0, 0, -2);
+
+		WHEN( "they are converted to spherical at PRECISE accuracy" ) {
+			transform::coordinates::to_spherical(points.data(), out.data(), n, transform::PRECISE);
+
+			THEN( "r, theta and phi are within the PRECISE bounds of libm" ) {
+				for (size_t i = 0; i < n; i++) {
+					double x = points[i].x, y = points[i].y, z = points[i].z, r = std::sqrt(x * x + y * y + z * z);
+					REQUIRE( out[i][0] == Approx( r ).epsilon(1e-6) );
+					REQUIRE( out[i][1] == Approx( r > 0 ? std::acos(z / r) : 0.0 ).margin(4e-7) );
+					REQUIRE( out[i][2] == Approx( std::atan2(y, x) ).margin(4e-7) );
+				}
+				REQUIRE( out[1][1] == 0.0f );
+				REQUIRE( out[2][1] == Approx( 3.14159265f ) );
+			}
+
+			THEN( "converting back restores the points" ) {
+				transform::coordinates::from_spherical(out.data(), back.data(), n, transform::PRECISE);
+				for (size_t i = 0; i < n; i++) {
+					for (int k = 0; k < 3; k++) { REQUIRE( back[i][k] == Approx( points[i][k] ).margin(2e-6) ); }
+				}
+			}
+		}
+
+		WHEN( "they are converted to cylindrical and back in place" ) {
+			back = points;
+			transform::coordinates::to_cylindrical(back.data(), back.data(), n);
+			transform::Vector3f cylindrical = back[5];
+			transform::coordinates::from_cylindrical(back.data(), back.data(), n);
+
+			THEN( "rho, phi and z are as expected, and the points are restored" ) {
+				double x = points[5].x, y = points[5].y;
+				REQUIRE( cylindrical[0] == Approx( std::hypot(x, y) ).epsilon(1e-6) );
+				REQUIRE( cylindrical[1] == Approx( std::atan2(y, x) ).margin(3e-6) );
+				REQUIRE( cylindrical[2] == points[5].z );
+				for (size_t i = 0; i < n; i++) {
+					for (int k = 0; k < 3; k++) { REQUIRE( back[i][k] == Approx( points[i][k] ).margin(2e-5) ); }
+				}
+			}
+		}
+	}
+}
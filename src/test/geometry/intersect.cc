@@ -0,0 +1,200 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <random>
+
+SCENARIO( "[Intersect] A ray finds the closest triangle it crosses.", "[Intersect]" )
+{
+	GIVEN( "Three parallel triangles at z = 3, 1, and 2, and a ray down the z axis." )
+	{
+		transform::Triangles triangles;
+		for (float z : { 3.0f, 1.0f, 2.0f }) {
+			triangles.add(transform::Vector3f(-1, -1, z), transform::Vector3f(3, -1, z), transform::Vector3f(-1, 3, z));
+		}
+		transform::Vector3f origin = transform::Vector3f(0.5f, 0.25f, 0);
+		transform::Vector3f direction = transform::Vector3f(0, 0, 1);
+
+		WHEN( "the closest hit is queried" ) {
+			transform::Hit hit;
+			bool found = transform::intersect(origin, direction, triangles, hit);
+
+			THEN( "the triangle at z = 1 is hit, with the right barycentrics" ) {
+				REQUIRE( found );
+				REQUIRE( hit.index == 1 );
+				REQUIRE( hit.t == Approx( 1.0f ) );
+				REQUIRE( hit.u == Approx( 0.375f ) );
+				REQUIRE( hit.v == Approx( 0.3125f ) );
+			}
+		}
+
+		WHEN( "the ray is limited to t < 0.5" ) {
+			transform::Hit hit;
+			bool found = transform::intersect(origin, direction, triangles, hit, transform::ANY, 0.0f, 0.5f);
+
+			THEN( "nothing is hit" ) {
+				REQUIRE( !found );
+				REQUIRE( hit.index == -1 );
+			}
+		}
+
+		WHEN( "the ray points away" ) {
+			transform::Hit hit;
+			bool found = transform::intersect(origin, transform::Vector3f(0, 0, -1), triangles, hit);
+
+			THEN( "nothing is hit" ) {
+				REQUIRE( !found );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Intersect] Rays through shared edges and vertices do not slip through.", "[Intersect]" )
+{
+	GIVEN( "A unit square split along its diagonal into two triangles." )
+	{
+		transform::Triangles triangles;
+		transform::Vector3f a = transform::Vector3f(0, 0, 0), b = transform::Vector3f(1, 0, 0);
+		transform::Vector3f c = transform::Vector3f(1, 1, 0), d = transform::Vector3f(0, 1, 0);
+		triangles.add(a, b, c);
+		triangles.add(c, d, a);
+
+		WHEN( "rays are cast through points along the diagonal, the corners included" ) {
+			THEN( "every ray hits" ) {
+				for (int k = 0; k <= 64; k++) {
+					float s = k / 64.0f;
+					transform::Hit hit;
+					REQUIRE( transform::intersect(transform::Vector3f(s, s, 1), transform::Vector3f(0, 0, -1), triangles, hit) );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Intersect] Rays through randomly placed shared edges do not slip through.", "[Intersect]" )
+{
+	GIVEN( "Parallelograms in random planes, each split along a diagonal, and rays aimed at points on it." )
+	{
+		std::mt19937 engine(17);
+		std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		auto random = [&](const float scale) {
+			return transform::Vector3f(scale * unit(engine), scale * unit(engine), scale * unit(engine));
+		};
+
+		const int quads = 2000, per = 20;
+		std::vector<transform::Triangles> pairs(quads);
+		transform::Rays rays;
+		std::vector<int> quad;
+		for (int i = 0; i < quads; i++) {
+			transform::Vector3f e0 = random(10), e1 = random(10), q0 = random(10);
+			transform::Vector3f q1 = transform::Vector3f(e0 + e1 - q0);
+			pairs[i].add(e0, e1, q0);
+			pairs[i].add(e1, e0, q1);
+
+			transform::Vector3f normal = transform::Vector3f(e1 - e0).cross(transform::Vector3f(q0 - e0));
+			normal.normalize();
+			for (int k = 0; k < per; k++) {
+				float s = 0.05f + 0.9f * (unit(engine) + 1) / 2;
+				transform::Vector3f p = transform::Vector3f(e0 + transform::Vector3f(e1 - e0) * s);
+				transform::Vector3f origin = transform::Vector3f(p + normal * (unit(engine) > 0 ? 3.0f : -3.0f) + random(1));
+				rays.add(origin, transform::Vector3f(p - origin));
+				quad.push_back(i);
+			}
+		}
+
+		WHEN( "each ray is cast alone against its pair of triangles" ) {
+			THEN( "every ray hits one of them" ) {
+				size_t misses = 0;
+				for (size_t r = 0; r < rays.size(); r++) {
+					transform::Hit hit;
+					misses += !transform::intersect(
+						transform::Vector3f(rays.ox[r], rays.oy[r], rays.oz[r]),
+						transform::Vector3f(rays.dx[r], rays.dy[r], rays.dz[r]),
+						pairs[quad[r]], hit
+					);
+				}
+				REQUIRE( misses == 0 );
+			}
+		}
+
+		WHEN( "each batch of rays is cast against every pair's triangles one at a time" ) {
+			THEN( "every ray hits the pair it was aimed at" ) {
+				size_t misses = 0;
+				for (int i = 0; i < quads; i++) {
+					transform::Rays batch;
+					for (size_t r = i * per; r < (size_t) (i + 1) * per; r++) {
+						batch.add(
+							transform::Vector3f(rays.ox[r], rays.oy[r], rays.oz[r]),
+							transform::Vector3f(rays.dx[r], rays.dy[r], rays.dz[r])
+						);
+					}
+					transform::intersect(batch, pairs[i]);
+					for (size_t r = 0; r < batch.size(); r++) { misses += (batch.index[r] < 0); }
+				}
+				REQUIRE( misses == 0 );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Intersect] Batched rays match rays cast one at a time.", "[Intersect]" )
+{
+	GIVEN( "A fan of 37 triangles, and 53 rays crossing it." )
+	{
+		transform::Triangles triangles;
+		for (int i = 0; i < 37; i++) {
+			float a0 = i * 0.17f, a1 = a0 + 0.6f;
+			triangles.add(
+				transform::Vector3f(0, 0, 1 + (i % 5) * 0.25f),
+				transform::Vector3f(2 * std::cos(a0), 2 * std::sin(a0), 1),
+				transform::Vector3f(2 * std::cos(a1), 2 * std::sin(a1), 2)
+			);
+		}
+
+		transform::Rays rays;
+		for (int r = 0; r < 53; r++) {
+			rays.add(transform::Vector3f(std::sin(r * 0.7f), std::cos(r * 0.3f), -1), transform::Vector3f(0.01f * r, -0.02f, 1));
+		}
+
+		WHEN( "all rays are tested against all triangles" ) {
+			transform::intersect(rays, triangles);
+
+			THEN( "each ray's closest hit matches the single ray query" ) {
+				for (size_t r = 0; r < rays.size(); r++) {
+					transform::Hit hit;
+					transform::intersect(
+						transform::Vector3f(rays.ox[r], rays.oy[r], rays.oz[r]),
+						transform::Vector3f(rays.dx[r], rays.dy[r], rays.dz[r]),
+						triangles, hit
+					);
+					REQUIRE( rays.index[r] == hit.index );
+					if (hit.index >= 0) {
+						REQUIRE( rays.tmax[r] == Approx( hit.t ) );
+						REQUIRE( rays.u[r] == Approx( hit.u ) );
+					}
+				}
+			}
+		}
+
+		WHEN( "all rays are tested triangle by triangle for any hit" ) {
+			for (size_t j = 0; j < triangles.size(); j++) {
+				transform::Vector3f a = transform::Vector3f(triangles.ax[j], triangles.ay[j], triangles.az[j]);
+				transform::Vector3f b = transform::Vector3f(triangles.bx[j], triangles.by[j], triangles.bz[j]);
+				transform::Vector3f c = transform::Vector3f(triangles.cx[j], triangles.cy[j], triangles.cz[j]);
+				transform::intersect(rays, a, b, c, (int) j, transform::ANY);
+			}
+
+			THEN( "exactly the rays with a closest hit are occluded" ) {
+				for (size_t r = 0; r < rays.size(); r++) {
+					transform::Hit hit;
+					bool found = transform::intersect(
+						transform::Vector3f(rays.ox[r], rays.oy[r], rays.oz[r]),
+						transform::Vector3f(rays.dx[r], rays.dy[r], rays.dz[r]),
+						triangles, hit, transform::ANY
+					);
+					REQUIRE( (rays.index[r] >= 0) == found );
+				}
+			}
+		}
+	}
+}
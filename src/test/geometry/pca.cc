@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO( "[PCA] Symmetric matrices are diagonalized.", "[PCA]" )
+{
+	GIVEN( "Eleven symmetric matrices, more than fit in one SIMD register." )
+	{
+		const size_t n = 11;
+		std::vector<float> m(n * 6), values(n * 3), vectors(n * 9);
+		for (size_t i = 0; i < n; i++) {
+			float* a = &m[i * 6];
+			a[0] = 4 + i; a[1] = 2 - 0.5f * i; a[2] = 1 + 0.1f * i;
+			a[3] = 0.5f * std::sin(i * 1.0f); a[4] = 0.3f * i; a[5] = (i % 3) - 1.0f;
+		}
+		m[0 * 6 + 3] = m[0 * 6 + 4] = m[0 * 6 + 5] = 0;	// already diagonal
+
+		WHEN( "they are solved" ) {
+			transform::eigen(m.data(), n, values.data(), vectors.data());
+
+			THEN( "each eigenpair satisfies A v = l v, eigenvalues descend, and the axes are orthonormal" ) {
+				for (size_t i = 0; i < n; i++) {
+					const float* a = &m[i * 6];
+					const float A[9] = { a[0], a[3], a[4], a[3], a[1], a[5], a[4], a[5], a[2] };
+					for (int j = 0; j < 3; j++) {
+						const float* v = &vectors[i * 9 + j * 3];
+						float l = values[i * 3 + j];
+						for (int r = 0; r < 3; r++) {
+							float av = A[r * 3] * v[0] + A[r * 3 + 1] * v[1] + A[r * 3 + 2] * v[2];
+							REQUIRE( av == Approx( l * v[r] ).margin(1e-4) );
+						}
+						for (int k = 0; k < 3; k++) {
+							const float* w = &vectors[i * 9 + k * 3];
+							REQUIRE( v[0] * w[0] + v[1] * w[1] + v[2] * w[2] == Approx( j == k ? 1.0f : 0.0f ).margin(1e-5) );
+						}
+					}
+					REQUIRE( values[i * 3] >= values[i * 3 + 1] );
+					REQUIRE( values[i * 3 + 1] >= values[i * 3 + 2] );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[PCA] Point sets yield normals and oriented bounding boxes.", "[PCA]" )
+{
+	GIVEN( "Two point sets in CSR order: a tilted 4 x 2 grid in the plane x + z = 2, and a line along y." )
+	{
+		std::vector<transform::Vector3f> points;
+		for (int i = 0; i < 5; i++) {
+			for (int j = 0; j < 3; j++) {
+				float s = i - 2.0f, t = j - 1.0f;
+				points.push_back(transform::Vector3f(1 + s * 0.70710678f, t * 0.5f, 1 - s * 0.70710678f));
+			}
+		}
+		for (int i = 0; i < 4; i++) { points.push_back(transform::Vector3f(3, (float) i, -1)); }
+		const size_t offsets[3] = { 0, 15, 19 };
+
+		WHEN( "both are analyzed" ) {
+			transform::Principal out[2];
+			transform::pca(points.data(), offsets, 2, out);
+
+			THEN( "the plane's normal is along {1,0,1}" ) {
+				transform::Vector3f normal = out[0].normal();
+				REQUIRE( std::fabs(normal.x) == Approx( 0.70710678f ).margin(1e-4) );
+				REQUIRE( normal.y == Approx( 0.0f ).margin(1e-4) );
+				REQUIRE( normal.x * normal.z > 0 );
+				REQUIRE( out[0].values[2] == Approx( 0.0f ).margin(1e-5) );
+			}
+
+			THEN( "the plane's box is centered on the grid, 4 by 1 by 0" ) {
+				REQUIRE( out[0].center[0] == Approx( 1.0f ) );
+				REQUIRE( out[0].center[1] == Approx( 0.0f ).margin(1e-5) );
+				REQUIRE( out[0].center[2] == Approx( 1.0f ) );
+				REQUIRE( out[0].half[0] == Approx( 2.0f ) );
+				REQUIRE( out[0].half[1] == Approx( 0.5f ) );
+				REQUIRE( out[0].half[2] == Approx( 0.0f ).margin(1e-5) );
+			}
+
+			THEN( "the line's principal axis is y, with variance 1.25" ) {
+				transform::Vector3f axis = out[1].axis(0);
+				REQUIRE( std::fabs(axis.y) == Approx( 1.0f ) );
+				REQUIRE( out[1].values[0] == Approx( 1.25f ) );
+				REQUIRE( out[1].centroid[1] == Approx( 1.5f ) );
+			}
+		}
+	}
+}
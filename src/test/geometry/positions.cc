@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO( "[Positions] Mixed-precision positions rebase to camera-relative floats.", "[Positions]" )
+{
+	GIVEN( "Points spread over 2 km, ten thousand kilometres from the world origin." )
+	{
+		const size_t n = 5003;
+		std::vector<transform::Vector3d> points(n);
+		for (size_t i = 0; i < n; i++) {
+			points[i] = transform::Vector3d(
+				1.0e7 + 1000 * std::sin(i * 0.01), -2.5e6 + 1000 * std::cos(i * 0.013), 3.0e6 + 0.001 * i
+			);
+		}
+		const transform::Vector3d camera(1.0e7 + 3.25, -2.5e6 + 999.5, 3.0e6 - 0.125);
+
+		transform::Positions positions(points.data(), n, 256);
+
+		THEN( "blocks cover the points in order" ) {
+			REQUIRE( positions.size() == n );
+			REQUIRE( positions.blocks() == (n + 255) / 256 );
+			REQUIRE( positions.offsets.front() == 0 );
+			REQUIRE( positions.offsets.back() == n );
+			for (size_t i = 0; i < n; i += 97) {
+				transform::Vector3d p = positions.position(i);
+				for (int k = 0; k < 3; k++) { REQUIRE( p[k] == Approx( points[i][k] ).margin(1e-4) ); }
+			}
+		}
+
+		WHEN( "they are rebased into component arrays and into Vector3f" ) {
+			std::vector<float> x(n), y(n), z(n);
+			std::vector<transform::Vector3f> relative(n), reference(n);
+			transform::rebase(positions, camera, x.data(), y.data(), z.data());
+			transform::rebase(positions, camera, relative.data());
+			transform::rebase(points.data(), n, camera, reference.data());
+
+			THEN( "they agree with the double precision reference to well under a millimetre" ) {
+				for (size_t i = 0; i < n; i++) {
+					REQUIRE( x[i] == relative[i].x );
+					REQUIRE( y[i] == relative[i].y );
+					REQUIRE( z[i] == relative[i].z );
+					for (int k = 0; k < 3; k++) { REQUIRE( relative[i][k] == Approx( reference[i][k] ).margin(2e-4) ); }
+				}
+			}
+
+			THEN( "they are far closer than subtracting float world positions" ) {
+				double rebased = 0, naive = 0;
+				const transform::Vector3f eye(camera);
+				for (size_t i = 0; i < n; i++) {
+					const transform::Vector3f world(points[i]);
+					for (int k = 0; k < 3; k++) {
+						double exact = points[i][k] - camera[k];
+						rebased = std::fmax(rebased, std::fabs(relative[i][k] - exact));
+						naive = std::fmax(naive, std::fabs((world[k] - eye[k]) - exact));
+					}
+				}
+				REQUIRE( rebased < 2e-4 );
+				REQUIRE( naive > 0.1 );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Positions] Blocks can be built by hand.", "[Positions]" )
+{
+	GIVEN( "Two blocks with explicit origins." )
+	{
+		transform::Positions positions;
+		positions.block(transform::Vector3d(1e9, 0, 0));
+		positions.add(transform::Vector3d(1e9 + 0.5, 1, 2));
+		positions.add(transform::Vector3d(1e9 - 0.25, 3, 4));
+		positions.block(transform::Vector3d(0, 0, -1e9));
+		positions.add(transform::Vector3d(5, 6, -1e9 + 7));
+
+		THEN( "offsets are stored relative to each block's origin" ) {
+			REQUIRE( positions.blocks() == 2 );
+			REQUIRE( positions.offsets[1] == 2 );
+			REQUIRE( positions.offsets[2] == 3 );
+			REQUIRE( positions.x[0] == 0.5f );
+			REQUIRE( positions.x[1] == -0.25f );
+			REQUIRE( positions.z[2] == 7.0f );
+			REQUIRE( positions.position(2).z == -1e9 + 7 );
+		}
+
+		WHEN( "they are rebased about a camera near the first block" ) {
+			float x[3], y[3], z[3];
+			transform::rebase(positions, transform::Vector3d(1e9, 1, 1), x, y, z);
+
+			THEN( "the near points keep their fractions" ) {
+				REQUIRE( x[0] == 0.5f );
+				REQUIRE( x[1] == -0.25f );
+				REQUIRE( y[1] == 2.0f );
+				REQUIRE( z[2] == Approx( -1e9 + 6 ) );
+			}
+		}
+
+		WHEN( "they are cleared" ) {
+			positions.clear();
+
+			THEN( "no blocks or positions remain" ) {
+				REQUIRE( positions.size() == 0 );
+				REQUIRE( positions.blocks() == 0 );
+				REQUIRE( positions.offsets.size() == 1 );
+			}
+		}
+	}
+
+	GIVEN( "Positions added without opening a block first." )
+	{
+		transform::Positions positions;
+		positions.add(transform::Vector3d(1e9, 2e9, 3e9));
+		positions.add(transform::Vector3d(1e9 + 0.5, 2e9, 3e9 - 0.25));
+
+		THEN( "the first opens a block at its own position" ) {
+			REQUIRE( positions.blocks() == 1 );
+			REQUIRE( positions.offsets[1] == 2 );
+			REQUIRE( positions.x[0] == 0.0f );
+			REQUIRE( positions.x[1] == 0.5f );
+			REQUIRE( positions.z[1] == -0.25f );
+			REQUIRE( positions.position(1).x == 1e9 + 0.5 );
+		}
+	}
+}
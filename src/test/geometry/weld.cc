@@ -0,0 +1,158 @@
+#include <catch2/catch.hpp>
+#include "transform/geometry.hh"
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+SCENARIO( "[Weld] Duplicate positions are merged.", "[Weld]" )
+{
+	GIVEN( "Positions with exact and near duplicates." )
+	{
+		std::vector<transform::Vector3f> p = {
+			transform::Vector3f(0, 0, 0), transform::Vector3f(1, 0, 0), transform::Vector3f(0.0001f, 0, -0.0001f),
+			transform::Vector3f(1, 0, 0), transform::Vector3f(0, 1, 0), transform::Vector3f(-0.0f, 0, 0)
+		};
+		std::vector<transform::Vector3f> out(p.size());
+		std::vector<uint32_t> remap(p.size());
+
+		WHEN( "they are welded with a tolerance of 1e-3" ) {
+			size_t count = transform::weld(p.data(), p.size(), 1e-3f, out.data(), remap.data());
+
+			THEN( "near duplicates join the first position in their cell, in order of first occurrence" ) {
+				REQUIRE( count == 3 );
+				const uint32_t expected[6] = { 0, 1, 0, 1, 2, 0 };
+				for (size_t i = 0; i < p.size(); i++) { REQUIRE( remap[i] == expected[i] ); }
+				bool equal = (out[0] == p[0]) && (out[1] == p[1]) && (out[2] == p[4]);
+				REQUIRE( equal );
+			}
+		}
+
+		WHEN( "they are welded exactly" ) {
+			size_t count = transform::weld(p.data(), p.size(), 0.0f, out.data(), remap.data());
+
+			THEN( "only bit-identical positions, and the two zeros, merge" ) {
+				REQUIRE( count == 4 );
+				REQUIRE( remap[3] == remap[1] );
+				REQUIRE( remap[5] == remap[0] );
+				REQUIRE( remap[2] != remap[0] );
+			}
+		}
+
+		WHEN( "they are welded in place" ) {
+			std::vector<transform::Vector3f> q = p;
+			size_t count = transform::weld(q.data(), q.size(), 1e-3f, q.data(), remap.data());
+
+			THEN( "the distinct positions are compacted to the front" ) {
+				REQUIRE( count == 3 );
+				bool equal = (q[0] == p[0]) && (q[1] == p[1]) && (q[2] == p[4]);
+				REQUIRE( equal );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Weld] Positions beyond the key range are clamped to its ends.", "[Weld]" )
+{
+	GIVEN( "Positions far on either side of the origin, and one near it." )
+	{
+		std::vector<transform::Vector3f> p = {
+			transform::Vector3f(1e10f, 0, 0), transform::Vector3f(-1e10f, 0, 0), transform::Vector3f(3e10f, 0, 0),
+			transform::Vector3f(0, 0, 0)
+		};
+		std::vector<transform::Vector<3, double>> q = {
+			transform::Vector3d(1e30, 0, 0), transform::Vector3d(-1e30, 0, 0), transform::Vector3d(0, 0, 0)
+		};
+		std::vector<transform::Vector3f> out(p.size());
+		std::vector<transform::Vector<3, double>> qout(q.size());
+		std::vector<uint32_t> remap(p.size());
+
+		WHEN( "they are welded with a tolerance of 1" ) {
+			size_t count = transform::weld(p.data(), p.size(), 1.0f, out.data(), remap.data());
+			size_t qcount = transform::weld(q.data(), q.size(), 1.0, qout.data(), remap.data());
+
+			THEN( "the two sides stay apart, and only positions past the same end merge" ) {
+				REQUIRE( count == 3 );
+				REQUIRE( qcount == 3 );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Weld] Inputs too large for 32-bit indices are rejected.", "[Weld]" )
+{
+	GIVEN( "A count of 2^32 - 1 positions, one more than the indices can number." )
+	{
+		const size_t n = 0xFFFFFFFF;
+		const transform::Vector3f* positions = nullptr;
+		transform::Vector3f* out = nullptr;
+
+		WHEN( "it is welded" ) {
+			THEN( "both entry points throw before touching the arrays, in every build" ) {
+				REQUIRE_THROWS_AS(
+					transform::weld(positions, n, 1.0f, out, nullptr), std::length_error
+				);
+				REQUIRE_THROWS_AS(
+					transform::weld((const int32_t*) nullptr, 3, n, nullptr, nullptr, 1), std::length_error
+				);
+			}
+		}
+	}
+}
+
+SCENARIO( "[Weld] Welding is deterministic across threads.", "[Weld]" )
+{
+	GIVEN( "Three hundred thousand double positions drawn from a small set of grid points." )
+	{
+		const size_t n = 300000;
+		std::vector<transform::Vector<3, double>> p(n);
+		for (size_t i = 0; i < n; i++) {
+			size_t j = (i * 7919) % 5003;
+			p[i] = transform::Vector3d(j % 17, (j / 17) % 19, j / 323 + 1e-9 * (i % 3));
+		}
+
+		WHEN( "they are welded on one thread and on four" ) {
+			std::vector<transform::Vector<3, double>> one(n), four(n);
+			std::vector<uint32_t> r1(n), r4(n);
+			size_t c1 = transform::weld(p.data(), n, 1e-6, one.data(), r1.data(), 1);
+			size_t c4 = transform::weld(p.data(), n, 1e-6, four.data(), r4.data(), 4);
+
+			THEN( "both find every distinct point, with identical output" ) {
+				REQUIRE( c1 == 5003 );
+				REQUIRE( c4 == c1 );
+				for (size_t i = 0; i < n; i++) {
+					REQUIRE( r4[i] == r1[i] );
+					REQUIRE( one[r1[i]].equals(p[i], 1e-6) );
+				}
+				for (size_t j = 0; j < c1; j++) {
+					bool equal = (one[j] == four[j]);
+					REQUIRE( equal );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Weld] Duplicates may be welded to a representative in another thread's share.", "[Weld]" )
+{
+	GIVEN( "Four hundred thousand positions repeating every thousand, so every representative is in the first share." )
+	{
+		const size_t n = 400000;
+		std::vector<transform::Vector3f> p(n);
+		for (size_t i = 0; i < n; i++) {
+			size_t j = i % 1000;
+			p[i] = transform::Vector3f((float) (j % 10), (float) (j / 10 % 10), (float) (j / 100));
+		}
+
+		WHEN( "they are welded on four threads" ) {
+			std::vector<transform::Vector3f> out(n);
+			std::vector<uint32_t> remap(n);
+			size_t count = transform::weld(p.data(), n, 0.5f, out.data(), remap.data(), 4);
+
+			THEN( "every position maps to the representative of its key" ) {
+				REQUIRE( count == 1000 );
+				for (size_t i = 0; i < n; i++) { REQUIRE( remap[i] == i % 1000 ); }
+			}
+		}
+	}
+}
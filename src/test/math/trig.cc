@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+#include "transform/math/trig.hh"
+
+#include <cmath>
+
+namespace
+{
+	using namespace transform::simd;
+
+	// worst absolute errors against libm, evaluated in double
+	template <transform::Accuracy A>
+	void measure(double& sc, double& at, double& ac)
+	{
+		sc = at = ac = 0;
+		for (int i = -200000; i < 200000; i += width) {
+			float x[width], s[width], c[width];
+			for (int l = 0; l < width; l++) { x[l] = (i + l) * 0.00031f; }	// about +-62 radians
+			floatv vs, vc;
+			sincos<A>(load(x), vs, vc);
+			store(s, vs);
+			store(c, vc);
+			for (int l = 0; l < width; l++) {
+				sc = std::fmax(sc, std::fabs(s[l] - std::sin((double) x[l])));
+				sc = std::fmax(sc, std::fabs(c[l] - std::cos((double) x[l])));
+			}
+		}
+		for (int i = -500; i <= 500; i++) {
+			for (int j = -500; j <= 500; j += width) {
+				float y[width], x[width], a[width];
+				for (int l = 0; l < width; l++) { y[l] = i * 0.37f; x[l] = (j + l) * 0.53f; }
+				store(a, atan2<A>(load(y), load(x)));
+				for (int l = 0; l < width; l++) { at = std::fmax(at, std::fabs(a[l] - std::atan2((double) y[l], (double) x[l]))); }
+			}
+		}
+		for (int i = -1000000; i <= 1000000; i += width) {
+			float x[width], a[width];
+			for (int l = 0; l < width; l++) { x[l] = std::fmin(1.0f, (i + l) * 1e-6f); }
+			store(a, transform::simd::acos<A>(load(x)));
+			for (int l = 0; l < width; l++) { ac = std::fmax(ac, std::fabs(a[l] - std::acos((double) x[l]))); }
+		}
+	}
+}
+
+SCENARIO( "[Trig] SIMD sine, cosine, arctangent and arccosine stay within their documented bounds.", "[Trig]" )
+{
+	GIVEN( "Dense samples of every input range." )
+	{
+		double sc, at, ac;
+
+		THEN( "FAST is within 2e-4, 7e-4 and 4e-4 of libm" ) {
+			measure<transform::FAST>(sc, at, ac);
+			REQUIRE( sc < 2e-4 );
+			REQUIRE( at < 7e-4 );
+			REQUIRE( ac < 4e-4 );
+		}
+
+		THEN( "MEDIUM is within 1e-6, 3e-6 and 2e-6 of libm" ) {
+			measure<transform::MEDIUM>(sc, at, ac);
+			REQUIRE( sc < 1e-6 );
+			REQUIRE( at < 3e-6 );
+			REQUIRE( ac < 2e-6 );
+		}
+
+		THEN( "PRECISE is within 2e-7, 4e-7 and 4e-7 of libm" ) {
+			measure<transform::PRECISE>(sc, at, ac);
+			REQUIRE( sc < 2e-7 );
+			REQUIRE( at < 4e-7 );
+			REQUIRE( ac < 4e-7 );
+		}
+	}
+}
+
+SCENARIO( "[Trig] atan2 handles axes and the origin.", "[Trig]" )
+{
+	GIVEN( "Points on the axes." )
+	{
+		THEN( "the angles are exact multiples of pi / 2, and zero at the origin" ) {
+			const float y[4] = { 0, 1, 0, -1 }, x[4] = { 1, 0, -1, 0 }, expected[4] = { 0, 1.57079633f, 3.14159265f, -1.57079633f };
+			for (int i = 0; i < 4; i++) {
+				float a[width];
+				store(a, transform::simd::atan2(set1(y[i]), set1(x[i])));
+				REQUIRE( a[0] == Approx( expected[i] ).margin(1e-7) );
+			}
+			float origin[width];
+			store(origin, transform::simd::atan2(zero(), zero()));
+			REQUIRE( origin[0] == 0.0f );
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <catch2/catch.hpp>
+#include "transform/random.hh"
+
+#include <vector>
+
+SCENARIO( "[Random] Philox4x32-10 matches the published known-answer vectors.", "[Random]" )
+{
+	GIVEN( "The Random123 test vectors." )
+	{
+		const uint32_t counter[3][4] = {
+			{ 0, 0, 0, 0 },
+			{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+			{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }
+		};
+		const uint32_t key[3][2] = { { 0, 0 }, { 0xffffffff, 0xffffffff }, { 0xa4093822, 0x299f31d0 } };
+		const uint32_t expected[3][4] = {
+			{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+			{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+			{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }
+		};
+
+		THEN( "the scalar rounds reproduce them" ) {
+			for (int i = 0; i < 3; i++) {
+				uint32_t out[4];
+				transform::Random::philox(counter[i], key[i], out);
+				for (int k = 0; k < 4; k++) { REQUIRE( out[k] == expected[i][k] ); }
+			}
+		}
+
+		THEN( "the SIMD generator reproduces them at the matching seed, stream and position" ) {
+			for (int i = 0; i < 3; i++) {
+				transform::Random rng(
+					((uint64_t) key[i][1] << 32) | key[i][0], ((uint64_t) counter[i][3] << 32) | counter[i][2]
+				);
+				rng.seek(((uint64_t) counter[i][1] << 32) | counter[i][0]);
+				uint32_t out[4];
+				rng.generate(out, 1);
+				for (int k = 0; k < 4; k++) { REQUIRE( out[k] == expected[i][k] ); }
+			}
+		}
+	}
+}
+
+SCENARIO( "[Random] Streams are seekable and independent of how they are split.", "[Random]" )
+{
+	GIVEN( "A generator with a seed and stream." )
+	{
+		transform::Random rng(1234, 7);
+		const size_t n = 37;	// not a multiple of any SIMD width
+		std::vector<uint32_t> whole(n * 4);
+		rng.generate(whole.data(), n);
+
+		THEN( "it advanced by one position per block" ) {
+			REQUIRE( rng.tell() == n );
+		}
+
+		WHEN( "the same blocks are drawn in uneven pieces" ) {
+			transform::Random split(1234, 7);
+			std::vector<uint32_t> pieces(n * 4);
+			split.generate(pieces.data(), 5);
+			split.generate(pieces.data() + 5 * 4, 19);
+			split.generate(pieces.data() + 24 * 4, n - 24);
+
+			THEN( "they match" ) {
+				for (size_t i = 0; i < n * 4; i++) { REQUIRE( pieces[i] == whole[i] ); }
+			}
+		}
+
+		WHEN( "a second generator seeks into the middle" ) {
+			transform::Random seeker(1234, 7);
+			seeker.seek(30);
+			uint32_t out[4];
+			seeker.generate(out, 1);
+
+			THEN( "it draws the block at that position" ) {
+				for (int k = 0; k < 4; k++) { REQUIRE( out[k] == whole[30 * 4 + k] ); }
+			}
+		}
+
+		WHEN( "another stream draws the same positions" ) {
+			transform::Random other(1234, 8);
+			std::vector<uint32_t> different(n * 4);
+			other.generate(different.data(), n);
+
+			THEN( "its blocks differ" ) {
+				size_t same = 0;
+				for (size_t i = 0; i < n * 4; i++) { same += (different[i] == whole[i]); }
+				REQUIRE( same < 4 );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Random] Uniform floats fill [0, 1).", "[Random]" )
+{
+	GIVEN( "A hundred thousand uniform floats." )
+	{
+		transform::Random rng(42);
+		const size_t n = 100001;
+		std::vector<float> u(n);
+		rng.uniform(u.data(), n);
+
+		THEN( "they lie in [0, 1), average one half, and used one block per four" ) {
+			double sum = 0;
+			for (size_t i = 0; i < n; i++) {
+				REQUIRE( u[i] >= 0.0f );
+				REQUIRE( u[i] < 1.0f );
+				sum += u[i];
+			}
+			REQUIRE( sum / n == Approx( 0.5 ).margin(0.005) );
+			REQUIRE( rng.tell() == (n + 3) / 4 );
+		}
+	}
+}
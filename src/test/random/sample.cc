@@ -0,0 +1,164 @@
+#include <catch2/catch.hpp>
+#include "transform/random.hh"
+
+#include <cmath>
+#include <vector>
+
+SCENARIO( "[Sample] Directions are unit length and cover their domain evenly.", "[Sample]" )
+{
+	GIVEN( "Fifty thousand samples of each distribution." )
+	{
+		const size_t n = 50003;
+		transform::Random rng(99);
+		std::vector<transform::Vector3f> sphere(n), hemisphere(n), cosine(n);
+		transform::sample::sphere(rng, sphere.data(), n);
+		transform::sample::hemisphere(rng, hemisphere.data(), n);
+		transform::sample::cosine(rng, cosine.data(), n);
+
+		THEN( "sphere directions are unit length and average to the origin" ) {
+			double mean[3] = { 0, 0, 0 };
+			for (size_t i = 0; i < n; i++) {
+				REQUIRE( sphere[i].length() == Approx( 1.0f ).margin(1e-5) );
+				for (int k = 0; k < 3; k++) { mean[k] += sphere[i][k] / n; }
+			}
+			for (int k = 0; k < 3; k++) { REQUIRE( mean[k] == Approx( 0.0 ).margin(0.01) ); }
+		}
+
+		THEN( "hemisphere directions are unit length, point up, and average z = 1 / 2" ) {
+			double z = 0;
+			for (size_t i = 0; i < n; i++) {
+				REQUIRE( hemisphere[i].length() == Approx( 1.0f ).margin(1e-5) );
+				REQUIRE( hemisphere[i].z >= 0.0f );
+				z += hemisphere[i].z / n;
+			}
+			REQUIRE( z == Approx( 0.5 ).margin(0.01) );
+		}
+
+		THEN( "cosine-weighted directions are unit length, point up, and average z = 2 / 3" ) {
+			double z = 0;
+			for (size_t i = 0; i < n; i++) {
+				REQUIRE( cosine[i].length() == Approx( 1.0f ).margin(1e-5) );
+				REQUIRE( cosine[i].z >= 0.0f );
+				z += cosine[i].z / n;
+			}
+			REQUIRE( z == Approx( 2.0 / 3.0 ).margin(0.01) );
+		}
+
+		THEN( "each draw used one block per sample" ) {
+			REQUIRE( rng.tell() == 3 * n );
+		}
+	}
+}
+
+SCENARIO( "[Sample] Points fill disks and boxes of any vector size.", "[Sample]" )
+{
+	GIVEN( "A generator." )
+	{
+		transform::Random rng(5, 1);
+		const size_t n = 20001;
+
+		WHEN( "a Vector2 array is filled with disk points" ) {
+			std::vector<transform::Vector2f> disk(n);
+			transform::sample::disk(rng, disk.data(), n);
+
+			THEN( "they lie in the unit disk with a quarter inside radius one half" ) {
+				size_t inner = 0;
+				for (size_t i = 0; i < n; i++) {
+					float r2 = disk[i].length2();
+					REQUIRE( r2 <= 1.0f + 1e-5f );
+					inner += (r2 < 0.25f);
+				}
+				REQUIRE( (double) inner / n == Approx( 0.25 ).margin(0.01) );
+			}
+		}
+
+		WHEN( "a Vector4 array is filled with sphere directions" ) {
+			std::vector<transform::Vector4f> directions(n);
+			transform::sample::sphere(rng, directions.data(), n);
+
+			THEN( "w is left zero" ) {
+				for (size_t i = 0; i < n; i++) {
+					REQUIRE( directions[i].w == 0.0f );
+					REQUIRE( directions[i].xyz().length() == Approx( 1.0f ).margin(1e-5) );
+				}
+			}
+		}
+
+		WHEN( "a Vector3 array is filled from a box" ) {
+			const transform::Vector3f lo(-1, 2, 10), hi(1, 3, 10.5f);
+			std::vector<transform::Vector3f> box(n);
+			transform::sample::box(rng, lo, hi, box.data(), n);
+
+			THEN( "every point is inside it" ) {
+				for (size_t i = 0; i < n; i++) {
+					for (int k = 0; k < 3; k++) {
+						REQUIRE( box[i][k] >= lo[k] );
+						REQUIRE( box[i][k] <= hi[k] );
+					}
+				}
+			}
+		}
+
+		WHEN( "a six-component array is filled from a box" ) {
+			transform::Vector<6, float> lo, hi;
+			for (int k = 0; k < 6; k++) { lo[k] = (float) -k; hi[k] = (float) k + 1; }
+			std::vector<transform::Vector<6, float>> box(n);
+			const uint64_t start = rng.tell();
+			transform::sample::box(rng, lo, hi, box.data(), n);
+
+			THEN( "every component is inside it and spread over it, two blocks to a sample" ) {
+				double mean[6] = { 0, 0, 0, 0, 0, 0 };
+				for (size_t i = 0; i < n; i++) {
+					for (int k = 0; k < 6; k++) {
+						REQUIRE( box[i][k] >= lo[k] );
+						REQUIRE( box[i][k] <= hi[k] );
+						mean[k] += box[i][k] / n;
+					}
+				}
+				for (int k = 0; k < 6; k++) { REQUIRE( mean[k] == Approx( 0.5 ).margin(0.05) ); }
+				REQUIRE( rng.tell() - start == 2 * n );
+			}
+
+			THEN( "the fill splits across calls like any other" ) {
+				std::vector<transform::Vector<6, float>> parts(n);
+				transform::Random worker(5, 1);
+				worker.seek(start);
+				transform::sample::box(worker, lo, hi, parts.data(), 7);
+				transform::sample::box(worker, lo, hi, parts.data() + 7, n - 7);
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (parts[i] == box[i]);
+					REQUIRE( equal );
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Sample] Parallel workers reproduce a single fill.", "[Sample]" )
+{
+	GIVEN( "Sphere directions drawn in one call." )
+	{
+		const size_t n = 1000;
+		std::vector<transform::Vector3f> whole(n), parts(n);
+		transform::Random rng(2024, 3);
+		transform::sample::sphere(rng, whole.data(), n);
+
+		WHEN( "four workers each seek to their own range of the stream" ) {
+			const size_t sizes[4] = { 1, 250, 333, 416 };
+			size_t begin = 0;
+			for (int w = 0; w < 4; w++) {
+				transform::Random worker(2024, 3);
+				worker.seek(begin);
+				transform::sample::sphere(worker, parts.data() + begin, sizes[w]);
+				begin += sizes[w];
+			}
+
+			THEN( "they draw exactly the same directions" ) {
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (parts[i] == whole[i]);
+					REQUIRE( equal );
+				}
+			}
+		}
+	}
+}
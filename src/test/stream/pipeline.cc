@@ -0,0 +1,157 @@
+#include <catch2/catch.hpp>
+#include "transform/stream.hh"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+// Serves `good` bytes of zeros, then fails as a broken device would.
+class failing : public std::streambuf
+{
+private:
+	char _buffer[64] = {};
+	size_t _left;
+
+public:
+	explicit failing(const size_t good) : _left(good) {}
+
+protected:
+	int_type underflow() override
+	{
+		if (!_left) { throw std::runtime_error("device error"); }
+		size_t n = (_left < sizeof(_buffer)) ? _left : sizeof(_buffer);
+		_left -= n;
+		setg(_buffer, _buffer, _buffer + n);
+		return traits_type::to_int_type(_buffer[0]);
+	}
+};
+
+SCENARIO( "[Pipeline] Records are streamed through every stage in chunks.", "[Pipeline]" )
+{
+	GIVEN( "A stream of 1000 Vector3f records {i,-i,2i}, and a pipeline with a chunk size of 64." )
+	{
+		const int n = 1000;
+		std::stringstream in;
+		for (int i = 0; i < n; i++) {
+			float r[3] = { (float) i, (float) -i, (float) (2 * i) };
+			in.write(reinterpret_cast<const char*>(r), sizeof(r));
+		}
+
+		transform::Pipeline3f pipeline = transform::Pipeline3f(64);
+
+		WHEN( "the records are translated by {1,1,1}, odd x is dropped, and the bounds are taken" ) {
+			transform::Vector<3, float> lo = transform::Vector3f(1e9f, 1e9f, 1e9f);
+			transform::Vector<3, float> hi = transform::Vector3f(-1e9f, -1e9f, -1e9f);
+			size_t seen = 0;
+
+			pipeline
+				.map([](transform::Vector<3, float>& v) { v += transform::Vector3f(1, 1, 1); })
+				.filter([](const transform::Vector<3, float>& v) { return ((int) v[0]) % 2 == 0; })
+				.reduce(seen, [](size_t acc, const transform::Vector<3, float>&) { return acc + 1; })
+				.bounds(lo, hi);
+
+			std::stringstream out;
+			size_t written = pipeline.run(in, &out);
+
+			THEN( "the odd-numbered half of the records is written, in order" ) {
+				REQUIRE( written == n / 2 );
+				REQUIRE( seen == n / 2 );
+
+				for (int i = 1; i < n; i += 2) {
+					float r[3];
+					out.read(reinterpret_cast<char*>(r), sizeof(r));
+					REQUIRE( r[0] == i + 1 );
+					REQUIRE( r[1] == -i + 1 );
+					REQUIRE( r[2] == 2 * i + 1 );
+				}
+			}
+
+			THEN( "the bounds cover the records kept" ) {
+				REQUIRE( lo[0] == 2 );
+				REQUIRE( hi[0] == 1000 );
+				REQUIRE( lo[1] == -998 );
+				REQUIRE( hi[1] == 0 );
+			}
+		}
+	}
+
+	GIVEN( "A stream ending in a partial record." )
+	{
+		std::stringstream in;
+		float r[4] = { 1, 2, 3, 4 };
+		in.write(reinterpret_cast<const char*>(r), sizeof(r));
+
+		WHEN( "it is run" ) {
+			THEN( "an error is raised" ) {
+				REQUIRE_THROWS( transform::Pipeline3f().run(in, nullptr) );
+			}
+		}
+	}
+
+	GIVEN( "A stream that fails part way through." )
+	{
+		failing device(12 * 1000);
+		std::istream in(&device);
+
+		WHEN( "it is run in chunks smaller than the good part" ) {
+			THEN( "the failure is reported rather than taken for the end of the stream" ) {
+				REQUIRE_THROWS_AS( transform::Pipeline3f(64).run(in, nullptr), std::runtime_error );
+			}
+		}
+	}
+
+	GIVEN( "A file that could not be opened." )
+	{
+		std::ifstream in("/nonexistent/records.bin", std::ios::binary);
+
+		WHEN( "it is run" ) {
+			THEN( "an error is raised" ) {
+				REQUIRE_THROWS_AS( transform::Pipeline3f().run(in, nullptr), std::runtime_error );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Pipeline] A const pipeline runs on several streams at once.", "[Pipeline]" )
+{
+	GIVEN( "A filtering pipeline and two streams of 100000 records." )
+	{
+		const int n = 100000;
+		std::stringstream a, b;
+		for (int i = 0; i < n; i++) {
+			float r[2] = { (float) i, (float) (n - i) };
+			a.write(reinterpret_cast<const char*>(r), sizeof(r));
+			std::swap(r[0], r[1]);
+			b.write(reinterpret_cast<const char*>(r), sizeof(r));
+		}
+
+		transform::Pipeline2f pipeline = transform::Pipeline2f(1000);
+		pipeline.filter([](const transform::Vector<2, float>& v) { return ((int) v[0]) % 3 == 0; });
+		const transform::Pipeline2f& shared = pipeline;
+
+		WHEN( "both are run on separate threads" ) {
+			std::stringstream oa, ob;
+			size_t wa = 0, wb = 0;
+			std::thread other([&] { wb = shared.run(b, &ob); });
+			wa = shared.run(a, &oa);
+			other.join();
+
+			THEN( "each keeps exactly its own records" ) {
+				REQUIRE( wa == (n + 2) / 3 );
+				REQUIRE( wb == (n + 1) / 3 );
+				for (size_t i = 0; i < wa; i++) {
+					float r[2];
+					oa.read(reinterpret_cast<char*>(r), sizeof(r));
+					REQUIRE( r[0] == 3.0f * i );
+				}
+				for (size_t i = 0; i < wb; i++) {
+					float r[2];
+					ob.read(reinterpret_cast<char*>(r), sizeof(r));
+					REQUIRE( ((int) r[0]) % 3 == 0 );
+					REQUIRE( r[0] + r[1] == (float) n );
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+#include "transform/transform.hh"
+
+static transform::Transformf translation(float x, float y, float z)
+{
+	transform::Transformf t = transform::Transformf();
+	t.translation.set(x, y, z);
+	return t;
+}
+
+SCENARIO( "[Hierarchy] World transforms are propagated from parent to child.", "[Hierarchy]" )
+{
+	GIVEN( "A chain of three nodes, each translated by {1,0,0} from its parent." )
+	{
+		transform::Hierarchyf h = transform::Hierarchyf();
+		size_t a = h.add(-1, translation(1, 0, 0));
+		size_t b = h.add((int) a, translation(1, 0, 0));
+		size_t c = h.add((int) b, translation(1, 0, 0));
+		h.update();
+
+		REQUIRE( h.position(a).x == 1 );
+		REQUIRE( h.position(b).x == 2 );
+		REQUIRE( h.position(c).x == 3 );
+
+		WHEN( "the middle node is moved" ) {
+			h.set_translation(b, transform::Vector3f(0, 5, 0));
+			h.update();
+
+			THEN( "its subtree follows, and its parent does not" ) {
+				REQUIRE( h.position(a).x == 1 );
+				REQUIRE( h.position(b).x == 1 );
+				REQUIRE( h.position(b).y == 5 );
+				REQUIRE( h.position(c).x == 2 );
+				REQUIRE( h.position(c).y == 5 );
+			}
+		}
+
+		WHEN( "the root is scaled by 2" ) {
+			transform::Transformf t = h.local(a);
+			t.scale.set(2, 2, 2);
+			h.set_local(a, t);
+			h.update();
+
+			THEN( "descendant offsets are scaled" ) {
+				REQUIRE( h.position(b).x == 3 );
+				REQUIRE( h.position(c).x == 5 );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Hierarchy] Parallel updates match serial updates.", "[Hierarchy]" )
+{
+	GIVEN( "Two identical forests of interleaved trees." )
+	{
+		transform::Hierarchyf serial = transform::Hierarchyf();
+		transform::Hierarchyf parallel = transform::Hierarchyf();
+		const int roots = 16;
+		const int depth = 20;
+
+		for (transform::Hierarchyf* h : { &serial, &parallel }) {
+			for (int r = 0; r < roots; r++) { h->add(-1, translation(r, 0, 0)); }
+			for (int d = 0; d < depth; d++) {
+				for (int r = 0; r < roots; r++) {
+					int parent = (d == 0) ? r : (int) h->size() - roots;
+					transform::Transformf t = translation(0, 1, 0);
+					t.rotation.set(0, 0, 0.09983342f, 0.99500417f);
+					h->add(parent, t);
+				}
+			}
+			for (int r = 0; r < 8; r++) { h->add(-1, translation(0, 0, r)); }
+		}
+
+		WHEN( "both are updated" ) {
+			serial.update();
+			parallel.update(4);
+
+			THEN( "every world matrix matches" ) {
+				for (size_t i = 0; i < serial.size(); i++) {
+					for (int k = 0; k < 12; k++) {
+						REQUIRE( parallel.world(i)[k] == serial.world(i)[k] );
+					}
+				}
+			}
+		}
+
+		WHEN( "after a first update, only the last root is moved and both are updated again" ) {
+			serial.update();
+			parallel.update(4);
+			serial.set_translation(serial.size() - 1, transform::Vector3f(5, 6, 7));
+			parallel.set_translation(parallel.size() - 1, transform::Vector3f(5, 6, 7));
+			serial.update();
+			parallel.update(4);
+
+			THEN( "the moved root is updated and every world matrix still matches" ) {
+				REQUIRE( parallel.position(parallel.size() - 1).x == 5.0f );
+				for (size_t i = 0; i < serial.size(); i++) {
+					for (int k = 0; k < 12; k++) {
+						REQUIRE( parallel.world(i)[k] == serial.world(i)[k] );
+					}
+				}
+			}
+		}
+	}
+}
+
+SCENARIO( "[Hierarchy] Nodes must name an existing parent.", "[Hierarchy]" )
+{
+	GIVEN( "A hierarchy of two nodes." )
+	{
+		transform::Hierarchyf h = transform::Hierarchyf();
+		h.add(-1, translation(0, 0, 0));
+		h.add(0, translation(1, 0, 0));
+
+		WHEN( "a node is added under a parent that does not exist yet" ) {
+			THEN( "it is rejected in every build, leaving the hierarchy unchanged" ) {
+				REQUIRE_THROWS_AS( h.add(2, translation(0, 0, 0)), std::out_of_range );
+				REQUIRE_THROWS_AS( h.add(-2, translation(0, 0, 0)), std::out_of_range );
+				REQUIRE( h.size() == 2 );
+			}
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch.hpp>
+#include "transform/transform.hh"
+
+SCENARIO( "[Transform] Transforms apply scale, then rotation, then translation.", "[Transform]" )
+{
+	GIVEN( "A default constructed Transform." )
+	{
+		transform::Transformf t = transform::Transformf();
+
+		WHEN( "a point is transformed" ) {
+			transform::Vector3f p = t.apply(transform::Vector3f(1, 2, 3));
+
+			THEN( "it is unchanged" ) {
+				REQUIRE( p.x == 1 );
+				REQUIRE( p.y == 2 );
+				REQUIRE( p.z == 3 );
+			}
+		}
+	}
+
+	GIVEN( "A Transform translating by {1,2,3}, rotating 90 degrees about z, and scaling by 2." )
+	{
+		const float h = 0.70710678f;
+		transform::Transformf t = transform::Transformf(
+			transform::Vector3f(1, 2, 3),
+			transform::Vector4f(0, 0, h, h),
+			transform::Vector3f(2, 2, 2)
+		);
+
+		WHEN( "the point {1,0,0} is transformed" ) {
+			transform::Vector3f p = t.apply(transform::Vector3f(1, 0, 0));
+
+			THEN( "the result is approximately {1,4,3}" ) {
+				REQUIRE( p.x == Approx( 1.0f ).margin(1e-5) );
+				REQUIRE( p.y == Approx( 4.0f ) );
+				REQUIRE( p.z == Approx( 3.0f ) );
+			}
+		}
+
+		WHEN( "the matrix is built" ) {
+			float m[12];
+			t.matrix(m);
+
+			THEN( "it transforms points the same way" ) {
+				transform::Vector3f q = transform::Vector3f(0.5f, -1, 2);
+				transform::Vector3f p = t.apply(q);
+				for (int r = 0; r < 3; r++) {
+					float v = m[r*4 + 0] * q.x + m[r*4 + 1] * q.y + m[r*4 + 2] * q.z + m[r*4 + 3];
+					REQUIRE( v == Approx( p[r] ).margin(1e-5) );
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+#ifdef TRANSFORM_INSTRUMENT
+
+#include <sstream>
+#include <thread>
+
+static transform::counters::Entry find(const std::string& type)
+{
+	for (const transform::counters::Entry& entry : transform::counters::snapshot()) {
+		if (entry.type == type) { return entry; }
+	}
+	return transform::counters::Entry { type, {} };
+}
+
+SCENARIO( "[Counters] Vector operations are counted per instantiation.", "[Counters]" )
+{
+	GIVEN( "Cleared counters." )
+	{
+		transform::counters::reset();
+
+		WHEN( "a Vector3f is normalized and its magnitude taken" ) {
+			transform::Vector3f a = transform::Vector3f(3, 0, 4);
+			a.normalize();
+			a.mag();
+
+			THEN( "two sqrts and three divisions are counted against Vector<3, float>" ) {
+				transform::counters::Entry entry = find("Vector<3, float>");
+				REQUIRE( entry.count[transform::counters::SQRT] == 2 );
+				REQUIRE( entry.count[transform::counters::DIVIDE] == 3 );
+				REQUIRE( entry.count[transform::counters::CONSTRUCT] == 1 );
+			}
+
+			THEN( "nothing is counted against Vector<3, double>" ) {
+				transform::counters::Entry entry = find("Vector<3, double>");
+				REQUIRE( entry.count[transform::counters::SQRT] == 0 );
+			}
+		}
+
+		WHEN( "copies are made on another thread that then exits" ) {
+			std::thread worker([] {
+				transform::Vector2d a = transform::Vector2d(1, 2);
+				transform::Vector2d b = a;
+				b = a;
+			});
+			worker.join();
+
+			THEN( "they are still counted" ) {
+				transform::counters::Entry entry = find("Vector<2, double>");
+				REQUIRE( entry.count[transform::counters::COPY] == 2 );
+			}
+		}
+
+		WHEN( "the counters are dumped" ) {
+			transform::Vector4i().zero();
+			std::ostringstream out;
+			transform::counters::dump(out);
+
+			THEN( "each instantiation is listed" ) {
+				REQUIRE( out.str().find("Vector<4, int>") != std::string::npos );
+			}
+		}
+	}
+}
+
+#endif
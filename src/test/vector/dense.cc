@@ -0,0 +1,96 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static double reference_dot(const float* a, const float* b, size_t n)
+{
+	double result = 0;
+	for (size_t i = 0; i < n; i++) { result += (double) a[i] * b[i]; }
+	return result;
+}
+
+SCENARIO( "[Dense] Long vector kernels match a double precision reference.", "[Dense]" )
+{
+	GIVEN( "A pair of Vector<131, float> with varied elements." )
+	{
+		transform::Vector<131, float> a, b;
+		for (int i = 0; i < 131; i++) {
+			a[i] = std::sin(i * 0.37f);
+			b[i] = std::cos(i * 0.11f) * 0.5f;
+		}
+
+		double ab = reference_dot(a.ptr(), b.ptr(), 131);
+		double aa = reference_dot(a.ptr(), a.ptr(), 131);
+		double bb = reference_dot(b.ptr(), b.ptr(), 131);
+
+		WHEN( "the dot product and squared length are calculated" ) {
+			THEN( "they match the reference" ) {
+				REQUIRE( a.dot(b) == Approx( ab ).epsilon(1e-5) );
+				REQUIRE( a.length2() == Approx( aa ).epsilon(1e-5) );
+			}
+		}
+
+		WHEN( "the cosine similarity is calculated" ) {
+			THEN( "it matches the reference" ) {
+				REQUIRE( a.cosine(b) == Approx( ab / std::sqrt(aa * bb) ).epsilon(1e-5) );
+				REQUIRE( a.cosine(a) == Approx( 1.0f ) );
+			}
+		}
+
+		WHEN( "the build is --no-fma" ) {
+			THEN( "the members keep the plain left-to-right sum, bit for bit" ) {
+				float plain = 0;
+				for (int i = 0; i < 131; i++) { plain = transform::math::fmadd(a[i], b[i], plain); }
+				bool exact = (a.dot(b) == plain);
+				REQUIRE( (exact || transform::dense::members) );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Dense] Top-k search returns the best scoring rows in order.", "[Dense]" )
+{
+	GIVEN( "500 rows of Vector<64, float>, and a query." )
+	{
+		const size_t count = 500;
+		std::vector<transform::Vector<64, float>> rows(count);
+		transform::Vector<64, float> query;
+		for (int i = 0; i < 64; i++) { query[i] = std::sin(i * 1.3f); }
+		for (size_t r = 0; r < count; r++) {
+			for (int i = 0; i < 64; i++) { rows[r][i] = std::sin(r * 0.71f + i * 0.29f) * (1 + r % 7); }
+		}
+
+		std::vector<std::pair<float, size_t>> expected;
+		for (size_t r = 0; r < count; r++) { expected.push_back({ -query.cosine(rows[r]), r }); }
+		std::sort(expected.begin(), expected.end());
+
+		WHEN( "the 10 most similar rows are found on one thread and on four" ) {
+			transform::dense::Match serial[10], parallel[10];
+			size_t n = transform::dense::topk(query, rows.data(), count, 10, serial);
+			size_t m = transform::dense::topk(query, rows.data(), count, 10, parallel, transform::dense::COSINE, 4);
+
+			THEN( "both match a full sort" ) {
+				REQUIRE( n == 10 );
+				REQUIRE( m == 10 );
+				for (int i = 0; i < 10; i++) {
+					REQUIRE( serial[i].index == expected[i].second );
+					REQUIRE( parallel[i].index == expected[i].second );
+					REQUIRE( serial[i].score == Approx( -expected[i].first ) );
+				}
+			}
+		}
+
+		WHEN( "more rows are requested than exist" ) {
+			std::vector<transform::dense::Match> out(count + 5);
+			size_t n = transform::dense::topk(query, rows.data(), count, count + 5, out.data(), transform::dense::DOT, 3);
+
+			THEN( "every row is returned, best first" ) {
+				REQUIRE( n == count );
+				for (size_t i = 1; i < n; i++) { REQUIRE( out[i - 1].score >= out[i].score ); }
+			}
+		}
+	}
+}
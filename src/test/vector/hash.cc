@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+#include <unordered_map>
+#include <unordered_set>
+
+SCENARIO( "[Hash] Vectors compare within a tolerance.", "[Hash]" )
+{
+	GIVEN( "Two vectors a small distance apart." )
+	{
+		const transform::Vector3f a(1.0f, 2.0f, 3.0f), b(1.0005f, 1.9995f, 3.0f);
+
+		THEN( "they are equal within a larger epsilon, but not a smaller one, nor exactly" ) {
+			REQUIRE( a.equals(b, 1e-3f) );
+			REQUIRE( b.equals(a, 1e-3f) );
+			REQUIRE_FALSE( a.equals(b, 1e-4f) );
+			REQUIRE( a.equals(a, 0.0f) );
+		}
+
+		THEN( "an integer vector compares the same way" ) {
+			const transform::Vector2i p(3, -4), q(4, -6);
+			REQUIRE( p.equals(q, 2) );
+			REQUIRE_FALSE( p.equals(q, 1) );
+		}
+	}
+}
+
+SCENARIO( "[Hash] Vectors hash consistently with equality.", "[Hash]" )
+{
+	GIVEN( "Equal vectors, one with negative zeros." )
+	{
+		const transform::Vector3f a(0.0f, 1.0f, 0.0f), b(-0.0f, 1.0f, -0.0f), c(0.0f, 0.0f, 1.0f);
+
+		THEN( "equal vectors hash alike and others differ" ) {
+			REQUIRE( transform::hash(a) == transform::hash(b) );
+			REQUIRE( transform::hash(a) != transform::hash(c) );
+			REQUIRE( std::hash<transform::Vector3f>()(a) == transform::hash(a) );
+		}
+
+		THEN( "vectors serve as keys of unordered containers" ) {
+			std::unordered_set<transform::Vector3f> set;
+			set.insert(a);
+			set.insert(c);
+			REQUIRE( set.size() == 2 );
+			REQUIRE( set.count(b) == 1 );
+
+			std::unordered_map<transform::Vector<2, int>, int> map;
+			for (int i = 0; i < 1000; i++) { map[transform::Vector2i(i % 10, i % 7)]++; }
+			REQUIRE( map.size() == 70 );
+		}
+	}
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+#include "transform/vector.hh"
+
+SCENARIO( "[Vector] Multiply-add functions return approriate values.", "[Vector]" )
+{
+	GIVEN( "A pair of Vector3, initialized to {1,2,3}, and {4,5,6} respectively." )
+	{
+		transform::Vector3f a = transform::Vector3f(1,2,3);
+		transform::Vector3f b = transform::Vector3f(4,5,6);
+
+		WHEN( "b is multiply-added into a with a scale of 2" ) {
+			a.madd(b, 2.0f);
+
+			THEN( "the result is {9,12,15}" ) {
+				bool equal = (a == transform::Vector3f(9, 12, 15));
+				REQUIRE( equal );
+			}
+		}
+
+		WHEN( "a is scaled by 2 and added to b" ) {
+			transform::Vector3f r = transform::madd(a, 2.0f, b);
+
+			THEN( "the result is {6,9,12}" ) {
+				bool equal = (r == transform::Vector3f(6, 9, 12));
+				REQUIRE( equal );
+			}
+		}
+
+		WHEN( "a, b, and a are fused element-wise" ) {
+			transform::Vector3f r = transform::fma(a, b, a);
+
+			THEN( "the result is {5,12,21}" ) {
+				bool equal = (r == transform::Vector3f(5, 12, 21));
+				REQUIRE( equal );
+			}
+		}
+
+		WHEN( "axpy is applied with a scale of -1" ) {
+			transform::axpy(-1.0f, a, b);
+
+			THEN( "b becomes {3,3,3}" ) {
+				bool equal = (b == transform::Vector3f(3, 3, 3));
+				REQUIRE( equal );
+			}
+		}
+
+		WHEN( "a and b are interpolated" ) {
+			THEN( "the endpoints are reproduced exactly" ) {
+				transform::Vector3f lo = a.lerp(b, 0.0f);
+				transform::Vector3f hi = a.lerp(b, 1.0f);
+				bool equal = (lo == a && hi == b);
+				REQUIRE( equal );
+			}
+
+			THEN( "the midpoint is {2.5,3.5,4.5}" ) {
+				transform::Vector3f mid = transform::lerp(a, b, 0.5f);
+				REQUIRE( mid.x == Approx( 2.5f ) );
+				REQUIRE( mid.y == Approx( 3.5f ) );
+				REQUIRE( mid.z == Approx( 4.5f ) );
+			}
+		}
+	}
+}
+
+SCENARIO( "[Vector] Batched multiply-add functions match their single-vector forms.", "[Vector]" )
+{
+	GIVEN( "Arrays of Vector3, with x[i] = {i,i+1,i+2} and y[i] = {1,1,1}." )
+	{
+		const size_t n = 17;
+		transform::Vector3f x[n], y[n], out[n];
+		for (size_t i = 0; i < n; i++) {
+			x[i].set(i, i + 1, i + 2);
+			y[i].set(1, 1, 1);
+		}
+
+		WHEN( "axpy is applied over the arrays" ) {
+			transform::axpy(3.0f, x, y, n);
+
+			THEN( "each y[i] equals 3 * x[i] + 1" ) {
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (y[i] == transform::Vector3f(3*i + 1, 3*i + 4, 3*i + 7));
+					REQUIRE( equal );
+				}
+			}
+		}
+
+		WHEN( "x and y are interpolated over the arrays" ) {
+			transform::lerp(x, y, 0.25f, out, n);
+
+			THEN( "each out[i] equals x[i].lerp(y[i])" ) {
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (out[i] == x[i].lerp(y[i], 0.25f));
+					REQUIRE( equal );
+				}
+			}
+		}
+
+		WHEN( "x is scaled by 2 and added to y over the arrays" ) {
+			transform::madd(x, 2.0f, y, out, n);
+
+			THEN( "each out[i] equals 2 * x[i] + y[i]" ) {
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (out[i] == transform::Vector3f(2*i + 1, 2*i + 3, 2*i + 5));
+					REQUIRE( equal );
+				}
+			}
+		}
+
+		WHEN( "x, x, and y are fused element-wise over the arrays" ) {
+			transform::fma(x, x, y, out, n);
+
+			THEN( "each out[i] equals x[i] * x[i] + y[i]" ) {
+				for (size_t i = 0; i < n; i++) {
+					bool equal = (out[i] == transform::fma(x[i], x[i], y[i]));
+					REQUIRE( equal );
+				}
+			}
+		}
+	}
+}
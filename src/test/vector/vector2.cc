@@ -134,3 +134,30 @@ SCENARIO( "[Vector2] Vector comparison functions return approriately.", "[Vector
 		}
 	}
 }
+
+SCENARIO( "[Vector2] Swizzles reorder and extend components.", "[Vector2]" )
+{
+	GIVEN( "A Vector2, initialized to {1,2}." )
+	{
+		transform::Vector2f a = transform::Vector2f(1,2);
+
+		WHEN( "the components are swapped" ) {
+			transform::Vector2f s = a.yx();
+
+			THEN( "the result is {2,1}" ) {
+				REQUIRE( s.x == 2 );
+				REQUIRE( s.y == 1 );
+			}
+		}
+
+		WHEN( "it is extended to homogeneous coordinates" ) {
+			transform::Vector3f s = a.xy1();
+
+			THEN( "the result is {1,2,1}" ) {
+				REQUIRE( s.x == 1 );
+				REQUIRE( s.y == 2 );
+				REQUIRE( s.z == 1 );
+			}
+		}
+	}
+}
@@ -143,3 +143,52 @@ SCENARIO( "[Vector3] Vector comparison functions return approriately.", "[Vector
 		}
 	}
 }
+
+SCENARIO( "[Vector3] Swizzles reorder, select, and extend components.", "[Vector3]" )
+{
+	GIVEN( "A Vector3, initialized to {1,2,3}." )
+	{
+		transform::Vector3f a = transform::Vector3f(1,2,3);
+
+		WHEN( "the components are reordered" ) {
+			transform::Vector3f s = a.xzy();
+
+			THEN( "the result is {1,3,2}" ) {
+				REQUIRE( s.x == 1 );
+				REQUIRE( s.y == 3 );
+				REQUIRE( s.z == 2 );
+			}
+		}
+
+		WHEN( "two components are selected" ) {
+			transform::Vector2f s = a.zx();
+
+			THEN( "the result is {3,1}" ) {
+				REQUIRE( s.x == 3 );
+				REQUIRE( s.y == 1 );
+			}
+		}
+
+		WHEN( "it is extended as a direction" ) {
+			transform::Vector4f s = a.xyz0();
+
+			THEN( "the result is {1,2,3,0}" ) {
+				REQUIRE( s.x == 1 );
+				REQUIRE( s.y == 2 );
+				REQUIRE( s.z == 3 );
+				REQUIRE( s.w == 0 );
+			}
+		}
+
+		WHEN( "a swizzle repeats a component" ) {
+			transform::Vector4f s = a.swizzle<transform::swizzle::Z, transform::swizzle::Z, transform::swizzle::ONE, transform::swizzle::X>();
+
+			THEN( "the result is {3,3,1,1}" ) {
+				REQUIRE( s.x == 3 );
+				REQUIRE( s.y == 3 );
+				REQUIRE( s.z == 1 );
+				REQUIRE( s.w == 1 );
+			}
+		}
+	}
+}
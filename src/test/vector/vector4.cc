@@ -152,3 +152,32 @@ SCENARIO( "[Vector4] Vector comparison functions return approriately.", "[Vector
 		}
 	}
 }
+
+SCENARIO( "[Vector4] Swizzles reorder and select components.", "[Vector4]" )
+{
+	GIVEN( "A Vector4, initialized to {1,2,3,4}." )
+	{
+		transform::Vector4f a = transform::Vector4f(1,2,3,4);
+
+		WHEN( "the xyz components are selected" ) {
+			transform::Vector3f s = a.xyz();
+
+			THEN( "the result is {1,2,3}" ) {
+				REQUIRE( s.x == 1 );
+				REQUIRE( s.y == 2 );
+				REQUIRE( s.z == 3 );
+			}
+		}
+
+		WHEN( "the components are reversed" ) {
+			transform::Vector4f s = a.wzyx();
+
+			THEN( "the result is {4,3,2,1}" ) {
+				REQUIRE( s.x == 4 );
+				REQUIRE( s.y == 3 );
+				REQUIRE( s.z == 2 );
+				REQUIRE( s.w == 1 );
+			}
+		}
+	}
+}
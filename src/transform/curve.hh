@@ -0,0 +1,16 @@
+#pragma once
+
+#include "curve/spline.hh"
+#include "curve/splines.hh"
+
+namespace transform
+{
+	typedef Spline<2, float>	Spline2f;
+	typedef Spline<2, double>	Spline2d;
+
+	typedef Spline<3, float>	Spline3f;
+	typedef Spline<3, double>	Spline3d;
+
+	typedef Spline<4, float>	Spline4f;
+	typedef Spline<4, double>	Spline4d;
+}
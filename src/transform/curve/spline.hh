@@ -0,0 +1,265 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "../math/fma.hh"
+#include "../vector.hh"
+
+namespace transform
+{
+	// A piecewise cubic curve. Bezier, Hermite, and Catmull-Rom control points are all converted to
+	// power basis coefficients a + b u + c u^2 + d u^3 per segment, so every curve type evaluates with the
+	// same Horner scheme. The parameter t runs from 0 to 1 over the whole curve, each segment taking an
+	// equal share of it.
+	//
+	// Construction also builds an arc-length table, a cumulative chord length at a fixed number of steps per
+	// segment, which maps distances along the curve back to t for constant-speed traversal.
+	//
+	// A default-constructed Spline has no segments; it evaluates to zero everywhere and has zero length.
+	template <int N, class T>
+	class Spline
+	{
+	private:
+		std::vector<T> _c;			// 4 * N per segment: a, b, c, d
+		std::vector<T> _lengths;	// distance at each step of the arc-length table
+
+		void segment(const T t, size_t& s, T& u) const;	// segment and local parameter of t
+
+	public:
+		static const size_t resolution = 32;	// default table steps per segment
+
+		Spline() = default;
+
+		// factories, taking arrays of any vector type with N components
+		template <class V>
+		static Spline<N, T> bezier(const V* points, const size_t n);	// n = 3 * segments + 1, shared end points; throws std::invalid_argument otherwise
+		template <class V>
+		static Spline<N, T> hermite(const V* points, const V* tangents, const size_t n);	// through n >= 2 points, or throws std::invalid_argument
+		template <class V>
+		static Spline<N, T> catmull_rom(const V* points, const size_t n);	// through n >= 2 points, uniform, or throws std::invalid_argument
+
+		size_t segments() const { return _c.size() / (4 * N); }
+		const T* coefficients(const size_t s) const { return &_c[s * 4 * N]; }	// a, b, c, d, N each
+
+		// evaluation
+		const typename vector_type<N, T>::type evaluate(const T t) const;
+		const typename vector_type<N, T>::type derivative(const T t) const;	// with respect to t
+		template <class V>
+		void evaluate(const T* t, const size_t n, V* out) const;	// many parameters
+		template <class V>
+		void tessellate(const size_t steps, V* out) const;	// segments() * steps + 1 evenly spaced parameters
+
+		// arc length
+		void measure(const size_t steps);	// rebuilds the table with steps per segment
+		T length() const { return _lengths.empty() ? T(0) : _lengths.back(); }
+		T parameter(const T distance) const;	// t at a distance along the curve, clamped to its ends
+		template <class V>
+		void travel(const T* distances, const size_t n, V* out) const;	// points at distances along the curve
+	};
+}
+
+using transform::Spline;
+
+template <int N, class T>
+template <class V>
+Spline<N, T> Spline<N, T>::bezier(const V* points, const size_t n)
+{
+	if (n < 4 || (n - 1) % 3 != 0) {
+		throw std::invalid_argument("transform::Spline::bezier: needs 3 * segments + 1 points, at least 4");
+	}
+
+	Spline<N, T> spline;
+	spline._c.resize((n - 1) / 3 * 4 * N);
+	for (size_t s = 0; s < spline.segments(); s++) {
+		const V* p = points + s * 3;
+		T* c = &spline._c[s * 4 * N];
+		for (int k = 0; k < N; k++) {
+			T p0 = p[0][k], p1 = p[1][k], p2 = p[2][k], p3 = p[3][k];
+			c[k] = p0;
+			c[N + k] = 3 * (p1 - p0);
+			c[2 * N + k] = 3 * (p0 - 2 * p1 + p2);
+			c[3 * N + k] = p3 - p0 + 3 * (p1 - p2);
+		}
+	}
+	spline.measure(resolution);
+	return spline;
+}
+
+template <int N, class T>
+template <class V>
+Spline<N, T> Spline<N, T>::hermite(const V* points, const V* tangents, const size_t n)
+{
+	if (n < 2) { throw std::invalid_argument("transform::Spline::hermite: needs at least 2 points"); }
+
+	// tangents are per segment-length step of u, as in the usual Hermite basis
+	Spline<N, T> spline;
+	spline._c.resize((n - 1) * 4 * N);
+	for (size_t s = 0; s + 1 < n; s++) {
+		T* c = &spline._c[s * 4 * N];
+		for (int k = 0; k < N; k++) {
+			T p0 = points[s][k], p1 = points[s + 1][k], m0 = tangents[s][k], m1 = tangents[s + 1][k];
+			c[k] = p0;
+			c[N + k] = m0;
+			c[2 * N + k] = 3 * (p1 - p0) - 2 * m0 - m1;
+			c[3 * N + k] = 2 * (p0 - p1) + m0 + m1;
+		}
+	}
+	spline.measure(resolution);
+	return spline;
+}
+
+template <int N, class T>
+template <class V>
+Spline<N, T> Spline<N, T>::catmull_rom(const V* points, const size_t n)
+{
+	if (n < 2) { throw std::invalid_argument("transform::Spline::catmull_rom: needs at least 2 points"); }
+
+	// tangent (next - previous) / 2, with the end points standing in for their missing neighbours
+	std::vector<Vector<N, T>> p(n), m(n);
+	for (size_t i = 0; i < n; i++) {
+		for (int k = 0; k < N; k++) { p[i][k] = points[i][k]; }
+	}
+	for (size_t i = 0; i < n; i++) {
+		const Vector<N, T>& prev = p[i > 0 ? i - 1 : i];
+		const Vector<N, T>& next = p[i + 1 < n ? i + 1 : i];
+		for (int k = 0; k < N; k++) { m[i][k] = (next[k] - prev[k]) / 2; }
+	}
+	return hermite(p.data(), m.data(), n);
+}
+
+template <int N, class T>
+void Spline<N, T>::segment(const T t, size_t& s, T& u) const
+{
+	const T x = std::min(std::max(t, T(0)), T(1)) * (T) segments();
+	s = std::min((size_t) x, segments() - 1);
+	u = x - (T) s;
+}
+
+template <int N, class T>
+const typename transform::vector_type<N, T>::type Spline<N, T>::evaluate(const T t) const
+{
+	typename transform::vector_type<N, T>::type out;
+	if (!segments()) {
+		for (int k = 0; k < N; k++) { out[k] = 0; }
+		return out;
+	}
+
+	size_t s;
+	T u;
+	segment(t, s, u);
+
+	const T* c = coefficients(s);
+	for (int k = 0; k < N; k++) {
+		T r = transform::math::fmadd(c[3 * N + k], u, c[2 * N + k]);
+		r = transform::math::fmadd(r, u, c[N + k]);
+		out[k] = transform::math::fmadd(r, u, c[k]);
+	}
+	return out;
+}
+
+template <int N, class T>
+const typename transform::vector_type<N, T>::type Spline<N, T>::derivative(const T t) const
+{
+	typename transform::vector_type<N, T>::type out;
+	if (!segments()) {
+		for (int k = 0; k < N; k++) { out[k] = 0; }
+		return out;
+	}
+
+	size_t s;
+	T u;
+	segment(t, s, u);
+
+	const T* c = coefficients(s);
+	for (int k = 0; k < N; k++) {
+		T r = transform::math::fmadd(3 * c[3 * N + k], u, 2 * c[2 * N + k]);
+		out[k] = transform::math::fmadd(r, u, c[N + k]) * (T) segments();
+	}
+	return out;
+}
+
+template <int N, class T>
+template <class V>
+void Spline<N, T>::evaluate(const T* t, const size_t n, V* out) const
+{
+	for (size_t i = 0; i < n; i++) {
+		const Vector<N, T> p = evaluate(t[i]);
+		for (int k = 0; k < N; k++) { out[i][k] = p[k]; }
+	}
+}
+
+template <int N, class T>
+template <class V>
+void Spline<N, T>::tessellate(const size_t steps, V* out) const
+{
+	// forward differences of the cubic at step h, three adds per component per point
+	const T h = T(1) / (T) steps, h2 = h * h, h3 = h2 * h;
+	size_t i = 0;
+	for (size_t s = 0; s < segments(); s++) {
+		const T* c = coefficients(s);
+		T f[N], d1[N], d2[N], d3[N];
+		for (int k = 0; k < N; k++) {
+			f[k] = c[k];
+			d1[k] = c[N + k] * h + c[2 * N + k] * h2 + c[3 * N + k] * h3;
+			d2[k] = 2 * c[2 * N + k] * h2 + 6 * c[3 * N + k] * h3;
+			d3[k] = 6 * c[3 * N + k] * h3;
+		}
+		for (size_t j = 0; j < steps; j++, i++) {
+			for (int k = 0; k < N; k++) {
+				out[i][k] = f[k];
+				f[k] += d1[k];
+				d1[k] += d2[k];
+				d2[k] += d3[k];
+			}
+		}
+	}
+
+	// the last point exactly, rather than accumulated
+	if (!segments()) {
+		for (int k = 0; k < N; k++) { out[i][k] = 0; }
+		return;
+	}
+	const T* c = coefficients(segments() - 1);
+	for (int k = 0; k < N; k++) { out[i][k] = c[k] + c[N + k] + c[2 * N + k] + c[3 * N + k]; }
+}
+
+template <int N, class T>
+void Spline<N, T>::measure(const size_t steps)
+{
+	if (!segments()) { _lengths.clear(); return; }
+
+	std::vector<Vector<N, T>> points(segments() * steps + 1);
+	tessellate(steps, points.data());
+
+	_lengths.resize(points.size());
+	_lengths[0] = 0;
+	for (size_t i = 1; i < points.size(); i++) {
+		_lengths[i] = _lengths[i - 1] + (points[i] - points[i - 1]).length();
+	}
+}
+
+template <int N, class T>
+T Spline<N, T>::parameter(const T distance) const
+{
+	if (distance <= 0) { return 0; }
+	if (distance >= length()) { return 1; }
+
+	// the table step containing distance, then linearly within it
+	size_t j = std::upper_bound(_lengths.begin(), _lengths.end(), distance) - _lengths.begin() - 1;
+	T step = _lengths[j + 1] - _lengths[j];
+	T f = (step > 0) ? (distance - _lengths[j]) / step : T(0);
+	return ((T) j + f) / (T) (_lengths.size() - 1);
+}
+
+template <int N, class T>
+template <class V>
+void Spline<N, T>::travel(const T* distances, const size_t n, V* out) const
+{
+	for (size_t i = 0; i < n; i++) {
+		const Vector<N, T> p = evaluate(parameter(distances[i]));
+		for (int k = 0; k < N; k++) { out[i][k] = p[k]; }
+	}
+}
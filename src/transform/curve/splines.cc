@@ -0,0 +1,72 @@
+#include "splines.hh"
+
+#include "../math/simd.hh"
+
+using namespace transform::simd;
+
+namespace
+{
+	// the output of curves with no segments
+	void zeros(const int dimensions, const size_t n, float* const* out)
+	{
+		for (int k = 0; k < dimensions; k++) { std::fill(out[k], out[k] + n, 0.0f); }
+	}
+}
+
+void transform::horner(
+	const float* c, const size_t segments, const size_t stride, const int dimensions, const float t,
+	const size_t begin, const size_t end, float* const* out
+)
+{
+	if (begin >= end) { return; }
+	if (!segments) { zeros(dimensions, end - begin, out); return; }
+
+	// one segment for every curve, so each coefficient is a contiguous run across curves
+	const float x = std::min(std::max(t, 0.0f), 1.0f) * segments;
+	const size_t s = std::min((size_t) x, segments - 1);
+	const floatv u = set1(x - s);
+	const float* cs = c + s * 4 * dimensions * stride;
+
+	for (size_t i = begin; i < end; i += width) {
+		for (int k = 0; k < dimensions; k++) {
+			const float* ck = cs + k * stride + i;
+			floatv r = simd::madd(load(ck + 3 * dimensions * stride), u, load(ck + 2 * dimensions * stride));
+			r = simd::madd(r, u, load(ck + dimensions * stride));
+			r = simd::madd(r, u, load(ck));
+			store(out[k] + (i - begin), r, end - i);
+		}
+	}
+}
+
+void transform::horner(
+	const float* c, const size_t segments, const size_t stride, const int dimensions, const float* t,
+	const size_t begin, const size_t end, float* const* out
+)
+{
+	if (!segments) { zeros(dimensions, end - begin, out); return; }
+
+	// each lane has its own segment, so the coefficients are gathered a lane at a time
+	for (size_t i = begin; i < end; i += width) {
+		size_t offset[width];
+		float u[width];
+		for (int l = 0; l < width; l++) {
+			const size_t j = (i + l < end) ? i + l : i;
+			const float x = std::min(std::max(t[j], 0.0f), 1.0f) * segments;
+			const size_t s = std::min((size_t) x, segments - 1);
+			offset[l] = s * 4 * dimensions * stride + i + l;
+			u[l] = x - s;
+		}
+		const floatv vu = load(u);
+
+		for (int k = 0; k < dimensions; k++) {
+			float a[4][width];
+			for (int p = 0; p < 4; p++) {
+				for (int l = 0; l < width; l++) { a[p][l] = c[offset[l] + (p * dimensions + k) * stride]; }
+			}
+			floatv r = simd::madd(load(a[3]), vu, load(a[2]));
+			r = simd::madd(r, vu, load(a[1]));
+			r = simd::madd(r, vu, load(a[0]));
+			store(out[k] + (i - begin), r, end - i);
+		}
+	}
+}
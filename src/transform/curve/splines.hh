@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "spline.hh"
+#include "../math/simd.hh"
+
+namespace transform
+{
+	// Many float splines with the same number of segments, for entities that each follow their own path.
+	// Coefficients are stored [segment][power][component][curve], so evaluating every curve at one parameter
+	// reads each coefficient as a contiguous run of curves and runs Horner's scheme a SIMD register of curves
+	// at a time. Curve counts are padded to a multiple of `padding`.
+	template <int N>
+	class Splines
+	{
+	private:
+		std::vector<float> _c;
+		size_t _segments = 0;
+		size_t _count = 0;
+		size_t _stride = 0;		// padded curve count
+
+	public:
+		static const size_t padding = 8;
+
+		Splines() = default;
+		Splines(const Spline<N, float>* curves, const size_t count);	// all with the same segment count, or throws std::invalid_argument
+
+		size_t size() const { return _count; }
+		size_t segments() const { return _segments; }
+
+		// every curve at one parameter, or curve i at t[i]; into one array per component, or vectors
+		// (the vector overloads step aside for arrays of component pointers)
+		void evaluate(const float t, float* const* out) const;
+		void evaluate(const float* t, float* const* out) const;
+		template <class V>
+		typename std::enable_if<!std::is_pointer<V>::value>::type evaluate(const float t, V* out) const;
+		template <class V>
+		typename std::enable_if<!std::is_pointer<V>::value>::type evaluate(const float* t, V* out) const;
+	};
+
+	// SIMD Horner kernels behind Splines, over curves begin to end, writing out[k][curve - begin]
+	void horner(
+		const float* c, const size_t segments, const size_t stride, const int dimensions, const float t,
+		const size_t begin, const size_t end, float* const* out
+	);
+	void horner(
+		const float* c, const size_t segments, const size_t stride, const int dimensions, const float* t,
+		const size_t begin, const size_t end, float* const* out
+	);
+}
+
+using transform::Splines;
+
+template <int N>
+Splines<N>::Splines(const Spline<N, float>* curves, const size_t count)
+	: _segments(count ? curves[0].segments() : 0), _count(count),
+	_stride((count + padding - 1) / padding * padding)
+{
+	// checked in every build, since a shorter curve would be read past its end
+	for (size_t i = 0; i < count; i++) {
+		if (curves[i].segments() != _segments) {
+			throw std::invalid_argument("transform::Splines: curves have different segment counts");
+		}
+	}
+
+	_c.assign(_segments * 4 * N * _stride, 0.0f);
+	for (size_t i = 0; i < count; i++) {
+		for (size_t s = 0; s < _segments; s++) {
+			const float* c = curves[i].coefficients(s);
+			for (int j = 0; j < 4 * N; j++) { _c[(s * 4 * N + j) * _stride + i] = c[j]; }
+		}
+	}
+}
+
+template <int N>
+void Splines<N>::evaluate(const float t, float* const* out) const
+{
+	horner(_c.data(), _segments, _stride, N, t, 0, _count, out);
+}
+
+template <int N>
+void Splines<N>::evaluate(const float* t, float* const* out) const
+{
+	horner(_c.data(), _segments, _stride, N, t, 0, _count, out);
+}
+
+template <int N>
+template <class V>
+typename std::enable_if<!std::is_pointer<V>::value>::type Splines<N>::evaluate(const float t, V* out) const
+{
+	simd::chunked<N>(out, _count, [&](float* const* c, const size_t i, const size_t m) {
+		horner(_c.data(), _segments, _stride, N, t, i, i + m, c);
+	});
+}
+
+template <int N>
+template <class V>
+typename std::enable_if<!std::is_pointer<V>::value>::type Splines<N>::evaluate(const float* t, V* out) const
+{
+	simd::chunked<N>(out, _count, [&](float* const* c, const size_t i, const size_t m) {
+		horner(_c.data(), _segments, _stride, N, t, i, i + m, c);
+	});
+}
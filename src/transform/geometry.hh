@@ -0,0 +1,7 @@
+#pragma once
+
+#include "geometry/intersect.hh"
+#include "geometry/pca.hh"
+#include "geometry/coordinates.hh"
+#include "geometry/positions.hh"
+#include "geometry/weld.hh"
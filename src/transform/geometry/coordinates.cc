@@ -0,0 +1,109 @@
+#include "coordinates.hh"
+
+#include "../math/trig.hh"
+
+using namespace transform::simd;
+using transform::Accuracy;
+
+namespace
+{
+	// Calls f with the tier as a compile-time constant, so each kernel is built once per tier.
+	template <class F>
+	inline void dispatch(const Accuracy a, F f)
+	{
+		switch (a) {
+		case transform::FAST: f(std::integral_constant<Accuracy, transform::FAST>()); break;
+		case transform::MEDIUM: f(std::integral_constant<Accuracy, transform::MEDIUM>()); break;
+		default: f(std::integral_constant<Accuracy, transform::PRECISE>()); break;
+		}
+	}
+}
+
+void transform::coordinates::to_polar(const float* x, const float* y, float* r, float* theta, const size_t n, const Accuracy a)
+{
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv px = load(x + i, n - i), py = load(y + i, n - i);
+			store(r + i, sqrt(simd::madd(px, px, mul(py, py))), n - i);
+			store(theta + i, atan2<tier>(py, px), n - i);
+		}
+	});
+}
+
+void transform::coordinates::from_polar(const float* r, const float* theta, float* x, float* y, const size_t n, const Accuracy a)
+{
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv pr = load(r + i, n - i), s, c;
+			sincos<tier>(load(theta + i, n - i), s, c);
+			store(x + i, mul(pr, c), n - i);
+			store(y + i, mul(pr, s), n - i);
+		}
+	});
+}
+
+void transform::coordinates::to_spherical(
+	const float* x, const float* y, const float* z, float* r, float* theta, float* phi, const size_t n,
+	const Accuracy a
+)
+{
+	// theta from atan2 rather than acos(z / r), which loses half its digits near the poles
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv px = load(x + i, n - i), py = load(y + i, n - i), pz = load(z + i, n - i);
+			floatv rho2 = simd::madd(px, px, mul(py, py));
+			store(r + i, sqrt(simd::madd(pz, pz, rho2)), n - i);
+			store(theta + i, atan2<tier>(sqrt(rho2), pz), n - i);
+			store(phi + i, atan2<tier>(py, px), n - i);
+		}
+	});
+}
+
+void transform::coordinates::from_spherical(
+	const float* r, const float* theta, const float* phi, float* x, float* y, float* z, const size_t n,
+	const Accuracy a
+)
+{
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv pr = load(r + i, n - i), st, ct, sp, cp;
+			sincos<tier>(load(theta + i, n - i), st, ct);
+			sincos<tier>(load(phi + i, n - i), sp, cp);
+			floatv rho = mul(pr, st);
+			store(x + i, mul(rho, cp), n - i);
+			store(y + i, mul(rho, sp), n - i);
+			store(z + i, mul(pr, ct), n - i);
+		}
+	});
+}
+
+void transform::coordinates::to_cylindrical(
+	const float* x, const float* y, const float* z, float* rho, float* phi, float* h, const size_t n,
+	const Accuracy a
+)
+{
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv px = load(x + i, n - i), py = load(y + i, n - i), pz = load(z + i, n - i);
+			store(rho + i, sqrt(simd::madd(px, px, mul(py, py))), n - i);
+			store(phi + i, atan2<tier>(py, px), n - i);
+			store(h + i, pz, n - i);
+		}
+	});
+}
+
+void transform::coordinates::from_cylindrical(
+	const float* rho, const float* phi, const float* h, float* x, float* y, float* z, const size_t n,
+	const Accuracy a
+)
+{
+	dispatch(a, [&](auto tier) {
+		for (size_t i = 0; i < n; i += width) {
+			floatv pr = load(rho + i, n - i), pz = load(h + i, n - i), s, c;
+			sincos<tier>(load(phi + i, n - i), s, c);
+			store(x + i, mul(pr, c), n - i);
+			store(y + i, mul(pr, s), n - i);
+			store(z + i, pz, n - i);
+		}
+	});
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "../math/accuracy.hh"
+#include "../math/simd.hh"
+#include "../vector.hh"
+
+namespace transform
+{
+	// Batched conversions between Cartesian and polar (r, theta), spherical (r, theta, phi), and cylindrical
+	// (rho, phi, z) coordinates, using the polynomial trigonometry of math/trig.hh at the given accuracy.
+	// Spherical theta is the angle from +z in [0, pi]; phi is the azimuth from +x in [-pi, pi]. The origin
+	// maps to zero angles. Input and output may be the same array.
+	namespace coordinates
+	{
+		// structure-of-arrays kernels
+		void to_polar(const float* x, const float* y, float* r, float* theta, const size_t n, const Accuracy = MEDIUM);
+		void from_polar(const float* r, const float* theta, float* x, float* y, const size_t n, const Accuracy = MEDIUM);
+		void to_spherical(
+			const float* x, const float* y, const float* z, float* r, float* theta, float* phi, const size_t n,
+			const Accuracy = MEDIUM
+		);
+		void from_spherical(
+			const float* r, const float* theta, const float* phi, float* x, float* y, float* z, const size_t n,
+			const Accuracy = MEDIUM
+		);
+		void to_cylindrical(
+			const float* x, const float* y, const float* z, float* rho, float* phi, float* h, const size_t n,
+			const Accuracy = MEDIUM
+		);
+		void from_cylindrical(
+			const float* rho, const float* phi, const float* h, float* x, float* y, float* z, const size_t n,
+			const Accuracy = MEDIUM
+		);
+
+		// The same over arrays of float vectors: Vector2 for polar, Vector3 for spherical and cylindrical.
+		template <class V>
+		void to_polar(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+		template <class V>
+		void from_polar(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+		template <class V>
+		void to_spherical(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+		template <class V>
+		void from_spherical(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+		template <class V>
+		void to_cylindrical(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+		template <class V>
+		void from_cylindrical(const V* in, V* out, const size_t n, const Accuracy = MEDIUM);
+
+		// simd::chunked over vectors of exactly D components, with kernel(c, m) converting in place
+		template <int D, class V, class F>
+		void convert(const V* in, V* out, const size_t n, F kernel);
+	}
+}
+
+template <int D, class V, class F>
+void transform::coordinates::convert(const V* in, V* out, const size_t n, F kernel)
+{
+	static_assert(V::dimensions == D, "wrong vector size for these coordinates");
+	simd::chunked<D>(in, out, n, [&](float* const* c, size_t, const size_t m) { kernel(c, m); });
+}
+
+template <class V>
+void transform::coordinates::to_polar(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<2>(in, out, n, [a](float* const* c, const size_t m) { to_polar(c[0], c[1], c[0], c[1], m, a); });
+}
+
+template <class V>
+void transform::coordinates::from_polar(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<2>(in, out, n, [a](float* const* c, const size_t m) { from_polar(c[0], c[1], c[0], c[1], m, a); });
+}
+
+template <class V>
+void transform::coordinates::to_spherical(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<3>(in, out, n, [a](float* const* c, const size_t m) {
+		to_spherical(c[0], c[1], c[2], c[0], c[1], c[2], m, a);
+	});
+}
+
+template <class V>
+void transform::coordinates::from_spherical(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<3>(in, out, n, [a](float* const* c, const size_t m) {
+		from_spherical(c[0], c[1], c[2], c[0], c[1], c[2], m, a);
+	});
+}
+
+template <class V>
+void transform::coordinates::to_cylindrical(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<3>(in, out, n, [a](float* const* c, const size_t m) {
+		to_cylindrical(c[0], c[1], c[2], c[0], c[1], c[2], m, a);
+	});
+}
+
+template <class V>
+void transform::coordinates::from_cylindrical(const V* in, V* out, const size_t n, const Accuracy a)
+{
+	convert<3>(in, out, n, [a](float* const* c, const size_t m) {
+		from_cylindrical(c[0], c[1], c[2], c[0], c[1], c[2], m, a);
+	});
+}
@@ -0,0 +1,335 @@
+#include "intersect.hh"
+
+#include <cmath>
+#include <utility>
+
+#include "../math/simd.hh"
+
+// The edge functions must round both of their products (see watertight below); keep the compiler from
+// fusing them into a multiply-add.
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+using namespace transform;
+using namespace transform::simd;
+
+namespace
+{
+	// Appends a padding block, filled with fill, to every array when n is about to cross into it.
+	template <class F, class... A>
+	void grow(const size_t n, const size_t padding, const F fill, A&... arrays)
+	{
+		if (n % padding == 0) { (arrays.resize(n + padding, fill), ...); }
+	}
+
+	// A ray's dominant axis kz, the other two kx and ky in the order that keeps triangle winding, and the
+	// shear taking its direction to +z.
+	struct Shear
+	{
+		int kx, ky, kz;
+		float sx, sy, sz;
+
+		Shear(const float* d)
+		{
+			kz = (std::abs(d[0]) > std::abs(d[1])) ? 0 : 1;
+			kz = (std::abs(d[2]) > std::abs(d[kz])) ? 2 : kz;
+			kx = (kz + 1) % 3;
+			ky = (kx + 1) % 3;
+			if (d[kz] < 0) { std::swap(kx, ky); }
+
+			// a zero direction (a padding ray) hits nothing
+			const float nan = std::numeric_limits<float>::quiet_NaN();
+			sx = (d[kz] != 0) ? d[kx] / d[kz] : nan;
+			sy = (d[kz] != 0) ? d[ky] / d[kz] : nan;
+			sz = (d[kz] != 0) ? 1.0f / d[kz] : nan;
+		}
+	};
+
+	// The edge functions of the lanes in m, recomputed from the sheared vertices in double, where the
+	// products are exact and the difference keeps its sign.
+	void edges_double(
+		const maskv m,
+		const floatv ax, const floatv ay, const floatv bx, const floatv by, const floatv cx, const floatv cy,
+		floatv& eu, floatv& ev, floatv& ew
+	)
+	{
+		float a[2][width], b[2][width], c[2][width], u[width], v[width], w[width];
+		store(a[0], ax); store(a[1], ay);
+		store(b[0], bx); store(b[1], by);
+		store(c[0], cx); store(c[1], cy);
+		store(u, eu); store(v, ev); store(w, ew);
+
+		const int lanes = bits(m);
+		for (int l = 0; l < width; l++) {
+			if (lanes & (1 << l)) {
+				u[l] = (float) ((double) c[0][l] * (double) b[1][l] - (double) c[1][l] * (double) b[0][l]);
+				v[l] = (float) ((double) a[0][l] * (double) c[1][l] - (double) a[1][l] * (double) c[0][l]);
+				w[l] = (float) ((double) b[0][l] * (double) a[1][l] - (double) b[1][l] * (double) a[0][l]);
+			}
+		}
+		eu = load(u); ev = load(v); ew = load(w);
+	}
+
+	// The watertight test on `width` ray and triangle pairs at once. Vertices are given relative to the ray
+	// origin, with components already permuted to the ray's kx, ky, and kz. Returns the lanes that hit, along
+	// with t, u, and v still scaled by |det|, which is also returned so the division can wait until a hit is
+	// known.
+	inline maskv watertight(
+		const floatv sx, const floatv sy, const floatv sz,
+		const floatv (&a)[3], const floatv (&b)[3], const floatv (&c)[3],
+		const floatv tmin, const floatv tmax,
+		floatv& t, floatv& u, floatv& v, floatv& adet
+	)
+	{
+		// shear so the ray runs along +z through the origin
+		const floatv ax = sub(a[0], mul(sx, a[2])), ay = sub(a[1], mul(sy, a[2]));
+		const floatv bx = sub(b[0], mul(sx, b[2])), by = sub(b[1], mul(sy, b[2]));
+		const floatv cx = sub(c[0], mul(sx, c[2])), cy = sub(c[1], mul(sy, c[2]));
+
+		// 2D edge functions at the origin, each product rounded on its own so that an edge shared by two
+		// triangles gets exactly opposite values in each; an exact zero may have lost its sign, so redo it
+		floatv eu = sub(mul(cx, by), mul(cy, bx));
+		floatv ev = sub(mul(ax, cy), mul(ay, cx));
+		floatv ew = sub(mul(bx, ay), mul(by, ax));
+		maskv exact = mask_or(eq(eu, zero()), mask_or(eq(ev, zero()), eq(ew, zero())));
+		if (bits(exact)) { edges_double(exact, ax, ay, bx, by, cx, cy, eu, ev, ew); }
+
+		floatv det = add(add(eu, ev), ew);
+		floatv tz = mul(sz, madd(eu, a[2], madd(ev, b[2], mul(ew, c[2]))));
+
+		// fold the sign of det into the edge functions and t, so every bound is compared against |det|
+		adet = abs(det);
+		eu = flipsign(eu, det);
+		u = flipsign(ev, det);
+		v = flipsign(ew, det);
+		t = flipsign(tz, det);
+
+		maskv m = ne(det, zero());
+		m = mask_and(m, ge(eu, zero()));
+		m = mask_and(m, ge(u, zero()));
+		m = mask_and(m, ge(v, zero()));
+		m = mask_and(m, gt(t, mul(tmin, adet)));
+		m = mask_and(m, lt(t, mul(tmax, adet)));
+		return m;
+	}
+
+	// A block of rays, each lane with its own permutation: masks for the lanes whose kx, ky, and kz are
+	// 0 and 1 (2 otherwise), the permuted origin, and the shear. When every lane shares one permutation,
+	// as rays from one camera mostly do, axes holds it and vertices are permuted before broadcasting.
+	struct Block
+	{
+		maskv k[3][2];
+		int axes[3];
+		bool uniform;
+		floatv o[3];
+		floatv sx, sy, sz;
+		floatv tmin, tmax;
+
+		Block(const Rays& rays, const size_t r)
+		{
+			uint32_t kk[3][width];
+			float ok[3][width], s[3][width];
+			uniform = true;
+			for (int l = 0; l < width; l++) {
+				const float d[3] = { rays.dx[r + l], rays.dy[r + l], rays.dz[r + l] };
+				const float origin[3] = { rays.ox[r + l], rays.oy[r + l], rays.oz[r + l] };
+				const Shear shear(d);
+				const int lane[3] = { shear.kx, shear.ky, shear.kz };
+				for (int j = 0; j < 3; j++) {
+					kk[j][l] = (uint32_t) lane[j];
+					ok[j][l] = origin[lane[j]];
+					uniform = uniform && (l == 0 || axes[j] == lane[j]);
+					axes[j] = (l == 0) ? lane[j] : axes[j];
+				}
+				s[0][l] = shear.sx; s[1][l] = shear.sy; s[2][l] = shear.sz;
+			}
+			for (int j = 0; j < 3; j++) {
+				k[j][0] = ieq(iload(kk[j]), iset1(0));
+				k[j][1] = ieq(iload(kk[j]), iset1(1));
+				o[j] = load(ok[j]);
+			}
+			sx = load(s[0]); sy = load(s[1]); sz = load(s[2]);
+			tmin = load(&rays.tmin[r]);
+			tmax = load(&rays.tmax[r]);
+		}
+
+		// a vertex broadcast to every lane, moved to each lane's origin and permuted to its axes
+		void relative(const float (&v)[3], floatv (&p)[3]) const
+		{
+			if (uniform) {
+				for (int j = 0; j < 3; j++) { p[j] = sub(set1(v[axes[j]]), o[j]); }
+				return;
+			}
+			const floatv x = set1(v[0]), y = set1(v[1]), z = set1(v[2]);
+			for (int j = 0; j < 3; j++) { p[j] = sub(select(k[j][0], x, select(k[j][1], y, z)), o[j]); }
+		}
+	};
+
+	// Every ray in the block starting at r against triangle j, with the block's range held in registers.
+	inline void test_block(
+		Rays& rays, const size_t r, Block& block,
+		const float (&va)[3], const float (&vb)[3], const float (&vc)[3], const int index, const Query query
+	)
+	{
+		floatv a[3], b[3], c[3];
+		block.relative(va, a);
+		block.relative(vb, b);
+		block.relative(vc, c);
+
+		floatv t, u, v, adet;
+		maskv m = watertight(block.sx, block.sy, block.sz, a, b, c, block.tmin, block.tmax, t, u, v, adet);
+
+		int hits = bits(m);
+		if (!hits) { return; }
+
+		floatv inv = div(set1(1.0f), adet);
+		t = mul(t, inv);
+		block.tmax = select(m, t, block.tmax);
+		if (query == ANY) { block.tmin = select(m, t, block.tmin); }
+
+		float lu[width], lv[width];
+		store(lu, mul(u, inv));
+		store(lv, mul(v, inv));
+		for (int l = 0; l < width; l++) {
+			if (hits & (1 << l)) {
+				rays.u[r + l] = lu[l];
+				rays.v[r + l] = lv[l];
+				rays.index[r + l] = index;
+			}
+		}
+	}
+}
+
+size_t Triangles::add(const Vector3f& a, const Vector3f& b, const Vector3f& c)
+{
+	grow(count, padding, std::numeric_limits<float>::quiet_NaN(), ax, ay, az, bx, by, bz, cx, cy, cz);
+	ax[count] = a.x; ay[count] = a.y; az[count] = a.z;
+	bx[count] = b.x; by[count] = b.y; bz[count] = b.z;
+	cx[count] = c.x; cy[count] = c.y; cz[count] = c.z;
+	return count++;
+}
+
+void Triangles::reserve(const size_t n)
+{
+	for (std::vector<float>* a : { &ax, &ay, &az, &bx, &by, &bz, &cx, &cy, &cz }) { a->reserve(n + padding); }
+}
+
+void Triangles::clear()
+{
+	for (std::vector<float>* a : { &ax, &ay, &az, &bx, &by, &bz, &cx, &cy, &cz }) { a->clear(); }
+	count = 0;
+}
+
+size_t Rays::add(const Vector3f& origin, const Vector3f& direction, const float tnear, const float tfar)
+{
+	grow(count, padding, 0, ox, oy, oz, dx, dy, dz, tmin, tmax, u, v, index);
+	ox[count] = origin.x; oy[count] = origin.y; oz[count] = origin.z;
+	dx[count] = direction.x; dy[count] = direction.y; dz[count] = direction.z;
+	tmin[count] = tnear;
+	tmax[count] = tfar;
+	u[count] = v[count] = 0.0f;
+	index[count] = -1;
+	return count++;
+}
+
+void Rays::reserve(const size_t n)
+{
+	for (std::vector<float>* a : { &ox, &oy, &oz, &dx, &dy, &dz, &tmin, &tmax, &u, &v }) { a->reserve(n + padding); }
+	index.reserve(n + padding);
+}
+
+void Rays::clear()
+{
+	for (std::vector<float>* a : { &ox, &oy, &oz, &dx, &dy, &dz, &tmin, &tmax, &u, &v }) { a->clear(); }
+	index.clear();
+	count = 0;
+}
+
+bool transform::intersect(
+	const Vector3f& origin, const Vector3f& direction, const Triangles& triangles, Hit& hit,
+	const Query query, const float tnear, const float tfar
+)
+{
+	const float d[3] = { direction.x, direction.y, direction.z };
+	const Shear shear(d);
+	const int axes[3] = { shear.kx, shear.ky, shear.kz };
+	const float o[3] = { origin.x, origin.y, origin.z };
+	const float* vertices[3][3] = {
+		{ triangles.ax.data(), triangles.ay.data(), triangles.az.data() },
+		{ triangles.bx.data(), triangles.by.data(), triangles.bz.data() },
+		{ triangles.cx.data(), triangles.cy.data(), triangles.cz.data() }
+	};
+	const floatv sx = set1(shear.sx), sy = set1(shear.sy), sz = set1(shear.sz);
+	const floatv tmin = set1(tnear);
+
+	hit.t = tfar;
+	hit.u = hit.v = 0.0f;
+	hit.index = -1;
+
+	const size_t n = triangles.ax.size();
+	for (size_t i = 0; i < n; i += width) {
+		floatv p[3][3];
+		for (int q = 0; q < 3; q++) {
+			for (int j = 0; j < 3; j++) { p[q][j] = sub(load(vertices[q][axes[j]] + i), set1(o[axes[j]])); }
+		}
+
+		floatv t, u, v, adet;
+		maskv m = watertight(sx, sy, sz, p[0], p[1], p[2], tmin, set1(hit.t), t, u, v, adet);
+
+		int hits = bits(m);
+		if (!hits) { continue; }
+
+		floatv inv = div(set1(1.0f), adet);
+		float lt[width], lu[width], lv[width];
+		store(lt, mul(t, inv));
+		store(lu, mul(u, inv));
+		store(lv, mul(v, inv));
+
+		for (int l = 0; l < width; l++) {
+			if ((hits & (1 << l)) && lt[l] < hit.t) {
+				hit.t = lt[l];
+				hit.u = lu[l];
+				hit.v = lv[l];
+				hit.index = (int) (i + l);
+			}
+		}
+		if (query == ANY) { return true; }
+	}
+
+	return hit.index >= 0;
+}
+
+void transform::intersect(
+	Rays& rays, const Vector3f& a, const Vector3f& b, const Vector3f& c, const int index, const Query query
+)
+{
+	const float va[3] = { a.x, a.y, a.z }, vb[3] = { b.x, b.y, b.z }, vc[3] = { c.x, c.y, c.z };
+
+	const size_t n = rays.ox.size();
+	for (size_t r = 0; r < n; r += width) {
+		Block block(rays, r);
+		test_block(rays, r, block, va, vb, vc, index, query);
+		store(&rays.tmin[r], block.tmin);
+		store(&rays.tmax[r], block.tmax);
+	}
+}
+
+// Blocks of rays stay in registers while every triangle is broadcast against them.
+void transform::intersect(Rays& rays, const Triangles& triangles, const Query query)
+{
+	const size_t n = rays.ox.size();
+	for (size_t r = 0; r < n; r += width) {
+		Block block(rays, r);
+		for (size_t j = 0; j < triangles.count; j++) {
+			const float va[3] = { triangles.ax[j], triangles.ay[j], triangles.az[j] };
+			const float vb[3] = { triangles.bx[j], triangles.by[j], triangles.bz[j] };
+			const float vc[3] = { triangles.cx[j], triangles.cy[j], triangles.cz[j] };
+			test_block(rays, r, block, va, vb, vc, (int) j, query);
+		}
+		store(&rays.tmin[r], block.tmin);
+		store(&rays.tmax[r], block.tmax);
+	}
+}
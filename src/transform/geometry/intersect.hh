@@ -0,0 +1,81 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// A triangle soup in structure-of-arrays layout: the three vertices, one array per component. Vertices
+	// are kept as given, so triangles sharing one see exactly the same coordinates. Arrays are padded with
+	// NaN triangles, which nothing hits, to a multiple of `padding`, so kernels can always load whole SIMD
+	// registers.
+	struct Triangles
+	{
+		static const size_t padding = 8;
+
+		std::vector<float> ax, ay, az;
+		std::vector<float> bx, by, bz;
+		std::vector<float> cx, cy, cz;
+		size_t count = 0;
+
+		size_t size() const { return count; }
+		size_t add(const Vector3f& a, const Vector3f& b, const Vector3f& c);	// returns the triangle's index
+		void reserve(const size_t n);
+		void clear();
+	};
+
+	// A batch of rays in structure-of-arrays layout, with the closest hit so far for each.
+	// A ray only reports hits with tmin < t < tmax, and each hit found sets tmax to its distance.
+	// ANY queries also raise tmin to that distance, which stops the ray being tested further.
+	struct Rays
+	{
+		static const size_t padding = 8;
+
+		std::vector<float> ox, oy, oz;		// origin
+		std::vector<float> dx, dy, dz;		// direction, need not be normalized
+		std::vector<float> tmin, tmax;
+		std::vector<float> u, v;			// barycentric coordinates of the hit
+		std::vector<int> index;				// triangle hit, or -1
+		size_t count = 0;
+
+		size_t size() const { return count; }
+		size_t add(
+			const Vector3f& origin, const Vector3f& direction,
+			const float tnear = 0.0f, const float tfar = std::numeric_limits<float>::infinity()
+		);	// returns the ray's index
+		void reserve(const size_t n);
+		void clear();
+	};
+
+	struct Hit
+	{
+		float t, u, v;
+		int index;	// -1 for a miss
+	};
+
+	enum Query
+	{
+		CLOSEST,	// nearest hit along each ray
+		ANY			// any hit at all, for occlusion tests; stops testing a ray once it has hit
+	};
+
+	// The watertight test of Woop, Benthin and Wald, evaluated a SIMD register of triangles (or rays) at a
+	// time. Vertices are sheared into a space where the ray runs along +z, and the 2D edge functions there
+	// are inclusive and recomputed in double when they come out exactly zero, so a ray through a shared edge
+	// or vertex is reported as hitting at least one of the triangles meeting there. u and v are the weights
+	// of b and c.
+	bool intersect(
+		const Vector3f& origin, const Vector3f& direction, const Triangles& triangles, Hit& hit,
+		const Query query = CLOSEST, const float tnear = 0.0f, const float tfar = std::numeric_limits<float>::infinity()
+	);	// one ray against every triangle
+
+	void intersect(
+		Rays& rays, const Vector3f& a, const Vector3f& b, const Vector3f& c, const int index,
+		const Query query = CLOSEST
+	);	// every ray against one triangle
+
+	void intersect(Rays& rays, const Triangles& triangles, const Query query = CLOSEST);	// every ray against every triangle
+}
@@ -0,0 +1,114 @@
+#include "pca.hh"
+
+#include "../math/simd.hh"
+
+using namespace transform::simd;
+
+namespace
+{
+	// Sweeps of the three off-diagonal rotations; Jacobi converges quadratically, so this reaches
+	// float precision for any input.
+	const int sweeps = 6;
+
+	// Zeroes apq with a Jacobi rotation in the (p, q) plane, where r is the remaining index.
+	// v is the eigenvector matrix so far, row-major, with eigenvectors as columns.
+	inline void rotate(
+		floatv& app, floatv& aqq, floatv& apq, floatv& arp, floatv& arq, floatv (&v)[9], const int p, const int q
+	)
+	{
+		const floatv one = set1(1.0f);
+		maskv live = ne(apq, zero());
+
+		floatv theta = div(sub(aqq, app), add(apq, apq));
+		floatv t = flipsign(div(one, add(abs(theta), sqrt(madd(theta, theta, one)))), theta);
+		t = select(live, t, zero());
+		floatv c = div(one, sqrt(madd(t, t, one)));
+		floatv s = mul(t, c);
+
+		app = sub(app, mul(t, apq));
+		aqq = madd(t, apq, aqq);
+		apq = zero();
+
+		floatv rp = arp, rq = arq;
+		arp = sub(mul(c, rp), mul(s, rq));
+		arq = madd(s, rp, mul(c, rq));
+
+		for (int k = 0; k < 3; k++) {
+			floatv kp = v[k * 3 + p], kq = v[k * 3 + q];
+			v[k * 3 + p] = sub(mul(c, kp), mul(s, kq));
+			v[k * 3 + q] = madd(s, kp, mul(c, kq));
+		}
+	}
+
+	// Orders eigenvalues i and j descending, swapping the matching eigenvector columns.
+	inline void order(floatv (&d)[3], floatv (&v)[9], const int i, const int j)
+	{
+		maskv swap = lt(d[i], d[j]);
+		floatv di = d[i];
+		d[i] = select(swap, d[j], di);
+		d[j] = select(swap, di, d[j]);
+		for (int k = 0; k < 3; k++) {
+			floatv vi = v[k * 3 + i];
+			v[k * 3 + i] = select(swap, v[k * 3 + j], vi);
+			v[k * 3 + j] = select(swap, vi, v[k * 3 + j]);
+		}
+	}
+}
+
+void transform::eigen(const float* matrices, const size_t count, float* values, float* vectors)
+{
+	for (size_t i = 0; i < count; i += width) {
+		const size_t lanes = (count - i < (size_t) width) ? count - i : (size_t) width;
+
+		// transpose a register of matrices into one register per element, padding with zeros
+		floatv a[6];
+		for (int k = 0; k < 6; k++) {
+			float lane[width] = {};
+			for (size_t l = 0; l < lanes; l++) { lane[l] = matrices[(i + l) * 6 + k]; }
+			a[k] = load(lane);
+		}
+		floatv& a00 = a[0];
+		floatv& a11 = a[1];
+		floatv& a22 = a[2];
+		floatv& a01 = a[3];
+		floatv& a02 = a[4];
+		floatv& a12 = a[5];
+
+		floatv v[9] = {
+			set1(1.0f), zero(), zero(),
+			zero(), set1(1.0f), zero(),
+			zero(), zero(), set1(1.0f)
+		};
+
+		for (int sweep = 0; sweep < sweeps; sweep++) {
+			rotate(a00, a11, a01, a02, a12, v, 0, 1);
+			rotate(a00, a22, a02, a01, a12, v, 0, 2);
+			rotate(a11, a22, a12, a01, a02, v, 1, 2);
+		}
+
+		floatv d[3] = { a00, a11, a22 };
+		order(d, v, 0, 1);
+		order(d, v, 0, 2);
+		order(d, v, 1, 2);
+
+		// make the frame right-handed: flip the last axis if (v0 x v1) . v2 < 0
+		floatv cx = sub(mul(v[3], v[7]), mul(v[6], v[4]));
+		floatv cy = sub(mul(v[6], v[1]), mul(v[0], v[7]));
+		floatv cz = sub(mul(v[0], v[4]), mul(v[3], v[1]));
+		floatv handed = simd::madd(cx, v[2], simd::madd(cy, v[5], mul(cz, v[8])));
+		for (int k = 0; k < 3; k++) { v[k * 3 + 2] = flipsign(v[k * 3 + 2], handed); }
+
+		float lane[width];
+		for (int k = 0; k < 3; k++) {
+			store(lane, d[k]);
+			for (size_t l = 0; l < lanes; l++) { values[(i + l) * 3 + k] = lane[l]; }
+		}
+		// eigenvector j is column j of v, and row j of the output
+		for (int j = 0; j < 3; j++) {
+			for (int k = 0; k < 3; k++) {
+				store(lane, v[k * 3 + j]);
+				for (size_t l = 0; l < lanes; l++) { vectors[(i + l) * 9 + j * 3 + k] = lane[l]; }
+			}
+		}
+	}
+}
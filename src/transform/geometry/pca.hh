@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// Principal axes of a point set, with the oriented bounding box along them.
+	struct Principal
+	{
+		float centroid[3];
+		float values[3];	// eigenvalues of the covariance, largest first
+		float axes[9];		// unit eigenvectors matching values, one per row, right-handed
+		float center[3];	// center of the oriented bounding box
+		float half[3];		// half extents of the box along each axis
+
+		const Vector3f axis(const int i) const { return Vector3f(axes[i * 3], axes[i * 3 + 1], axes[i * 3 + 2]); }
+		const Vector3f normal() const { return axis(2); }	// least-variance direction, up to sign
+	};
+
+	// Diagonalizes count symmetric 3x3 matrices, given as {xx, yy, zz, xy, xz, yz}, a SIMD register of matrices
+	// at a time. Uses a fixed number of cyclic Jacobi sweeps, with every rotation applied through lane selects
+	// rather than branches. Writes three eigenvalues per matrix, largest first, and the matching unit
+	// eigenvectors as the rows of a 3x3 matrix.
+	void eigen(const float* matrices, const size_t count, float* values, float* vectors);
+
+	// Principal component analysis of many small point sets. Set i is points[offsets[i]] up to
+	// points[offsets[i + 1]], as in compressed sparse row storage, so offsets holds sets + 1 entries.
+	template <class V>
+	void pca(const V* points, const size_t* offsets, const size_t sets, Principal* out);
+
+	template <class V>
+	void pca(const V* points, const size_t count, Principal& out);
+}
+
+template <class V>
+void transform::pca(const V* points, const size_t* offsets, const size_t sets, Principal* out)
+{
+	std::vector<float> covariance(sets * 6), values(sets * 3), vectors(sets * 9);
+
+	// centroid, then covariance about it
+	for (size_t i = 0; i < sets; i++) {
+		const size_t begin = offsets[i], end = offsets[i + 1];
+		const float n = (end > begin) ? (float) (end - begin) : 1.0f;
+
+		float c[3] = { 0, 0, 0 };
+		for (size_t j = begin; j < end; j++) {
+			for (int k = 0; k < 3; k++) { c[k] += points[j][k]; }
+		}
+		for (int k = 0; k < 3; k++) { out[i].centroid[k] = c[k] / n; }
+
+		float* a = &covariance[i * 6];
+		for (int k = 0; k < 6; k++) { a[k] = 0; }
+		for (size_t j = begin; j < end; j++) {
+			float x = points[j][0] - out[i].centroid[0];
+			float y = points[j][1] - out[i].centroid[1];
+			float z = points[j][2] - out[i].centroid[2];
+			a[0] += x * x; a[1] += y * y; a[2] += z * z;
+			a[3] += x * y; a[4] += x * z; a[5] += y * z;
+		}
+		for (int k = 0; k < 6; k++) { a[k] /= n; }
+	}
+
+	eigen(covariance.data(), sets, values.data(), vectors.data());
+
+	// bounding box along the axes
+	for (size_t i = 0; i < sets; i++) {
+		Principal& p = out[i];
+		for (int k = 0; k < 3; k++) { p.values[k] = values[i * 3 + k]; }
+		for (int k = 0; k < 9; k++) { p.axes[k] = vectors[i * 9 + k]; }
+
+		float lo[3] = { 0, 0, 0 }, hi[3] = { 0, 0, 0 };
+		for (size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+			float d[3] = { points[j][0] - p.centroid[0], points[j][1] - p.centroid[1], points[j][2] - p.centroid[2] };
+			for (int k = 0; k < 3; k++) {
+				float s = d[0] * p.axes[k * 3] + d[1] * p.axes[k * 3 + 1] + d[2] * p.axes[k * 3 + 2];
+				lo[k] = (s < lo[k]) ? s : lo[k];
+				hi[k] = (s > hi[k]) ? s : hi[k];
+			}
+		}
+
+		for (int k = 0; k < 3; k++) {
+			p.half[k] = (hi[k] - lo[k]) / 2;
+			p.center[k] = p.centroid[k];
+		}
+		for (int k = 0; k < 3; k++) {
+			float mid = (hi[k] + lo[k]) / 2;
+			for (int c = 0; c < 3; c++) { p.center[c] += p.axes[k * 3 + c] * mid; }
+		}
+	}
+}
+
+template <class V>
+void transform::pca(const V* points, const size_t count, Principal& out)
+{
+	const size_t offsets[2] = { 0, count };
+	pca(points, offsets, 1, &out);
+}
@@ -0,0 +1,88 @@
+#include "positions.hh"
+
+#include <algorithm>
+
+#include "../math/simd.hh"
+
+using namespace transform;
+using namespace transform::simd;
+
+Positions::Positions(const Vector3d* points, const size_t n, const size_t block) : offsets(1, 0)
+{
+	reserve(n);
+	for (size_t begin = 0; begin < n; begin += block) {
+		const size_t end = std::min(begin + block, n);
+
+		Vector3d lo(points[begin]), hi(points[begin]);
+		for (size_t i = begin + 1; i < end; i++) {
+			for (int k = 0; k < 3; k++) {
+				lo[k] = std::min(lo[k], points[i][k]);
+				hi[k] = std::max(hi[k], points[i][k]);
+			}
+		}
+
+		this->block((lo + hi) / 2.0);
+		for (size_t i = begin; i < end; i++) { add(points[i]); }
+	}
+}
+
+size_t Positions::block(const Vector3d& origin)
+{
+	origins.push_back(origin);
+	offsets.push_back(size());
+	return blocks() - 1;
+}
+
+size_t Positions::add(const Vector3d& position)
+{
+	if (origins.empty()) { block(position); }
+	const Vector3f offset(position - origins.back());
+	x.push_back(offset.x);
+	y.push_back(offset.y);
+	z.push_back(offset.z);
+	offsets.back() = size();
+	return size() - 1;
+}
+
+const Vector3d Positions::position(const size_t i) const
+{
+	const size_t b = std::upper_bound(offsets.begin(), offsets.end(), i) - offsets.begin() - 1;
+	return origins[b] + Vector3d(x[i], y[i], z[i]);
+}
+
+void Positions::reserve(const size_t n)
+{
+	x.reserve(n);
+	y.reserve(n);
+	z.reserve(n);
+}
+
+void Positions::clear()
+{
+	origins.clear();
+	offsets.assign(1, 0);
+	x.clear();
+	y.clear();
+	z.clear();
+}
+
+void transform::rebase(const Positions& positions, const Vector3d& camera, float* x, float* y, float* z)
+{
+	for (size_t b = 0; b < positions.blocks(); b++) {
+		const Vector3f delta(positions.origins[b] - camera);
+		const floatv dx = set1(delta.x), dy = set1(delta.y), dz = set1(delta.z);
+
+		const size_t end = positions.offsets[b + 1];
+		for (size_t i = positions.offsets[b]; i < end; i += width) {
+			const size_t n = end - i;
+			store(x + i, add(load(&positions.x[i], n), dx), n);
+			store(y + i, add(load(&positions.y[i], n), dy), n);
+			store(z + i, add(load(&positions.z[i], n), dz), n);
+		}
+	}
+}
+
+void transform::rebase(const Vector3d* positions, const size_t n, const Vector3d& camera, Vector3f* out)
+{
+	for (size_t i = 0; i < n; i++) { out[i] = Vector3f(positions[i] - camera); }
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <vector>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// World positions beyond float precision, stored as a double precision origin per block plus float offsets
+	// from it, one array per component. Block i holds positions offsets[i] to offsets[i + 1], as in compressed
+	// sparse row storage; the smaller a block's extent, the more precise its offsets.
+	struct Positions
+	{
+		std::vector<Vector3d> origins;		// one per block
+		std::vector<size_t> offsets;		// blocks + 1 entries
+		std::vector<float> x, y, z;			// offset from the block's origin
+
+		Positions() : offsets(1, 0) {}
+		Positions(const Vector3d* points, const size_t n, const size_t block = 1024);	// consecutive points, each block about the center of its bounds
+
+		size_t size() const { return x.size(); }
+		size_t blocks() const { return origins.size(); }
+		size_t block(const Vector3d& origin);		// starts a block, returning its index
+		size_t add(const Vector3d& position);		// into the last block, opening one at position if there is none; returns the position's index
+		const Vector3d position(const size_t i) const;
+		void reserve(const size_t n);
+		void clear();
+	};
+
+	// Camera-relative float positions. Each block's origin - camera is taken in double and rounded to float
+	// once, then added to the block's offsets a SIMD register at a time.
+	void rebase(const Positions& positions, const Vector3d& camera, float* x, float* y, float* z);
+
+	template <class V>
+	void rebase(const Positions& positions, const Vector3d& camera, V* out);
+
+	// The same from full double positions, through the converting constructor: the scalar reference.
+	void rebase(const Vector3d* positions, const size_t n, const Vector3d& camera, Vector3f* out);
+}
+
+template <class V>
+void transform::rebase(const Positions& positions, const Vector3d& camera, V* out)
+{
+	for (size_t b = 0; b < positions.blocks(); b++) {
+		const Vector3f delta(positions.origins[b] - camera);
+		for (size_t i = positions.offsets[b]; i < positions.offsets[b + 1]; i++) {
+			out[i][0] = positions.x[i] + delta.x;
+			out[i][1] = positions.y[i] + delta.y;
+			out[i][2] = positions.z[i] + delta.z;
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#include "weld.hh"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+using transform::mix;
+
+namespace
+{
+	const uint32_t empty = 0xFFFFFFFF;
+
+	template <class K>
+	inline uint64_t hash_key(const K* key, const int dimensions)
+	{
+		uint64_t h = dimensions;
+		for (int k = 0; k < dimensions; k++) { h = mix(h, (uint64_t) key[k]); }
+		return h;
+	}
+
+	template <class K>
+	inline bool same(const K* a, const K* b, const int dimensions)
+	{
+		for (int k = 0; k < dimensions; k++) { if (a[k] != b[k]) { return false; } }
+		return true;
+	}
+}
+
+template <class K>
+size_t transform::weld(const K* keys, const int dimensions, const size_t n, uint32_t* remap, uint32_t* first, const unsigned threads)
+{
+	// indices are 32 bits, with the all-ones value marking empty slots; checked in every build, since larger
+	// inputs would silently truncate
+	if (n >= empty) { throw std::length_error("transform::weld: more than 2^32 - 2 positions"); }
+
+	// at most half full, so linear probes stay short
+	size_t capacity = 16;
+	while (capacity < 2 * n) { capacity *= 2; }
+	const size_t mask = capacity - 1;
+	std::unique_ptr<std::atomic<uint32_t>[]> table(new std::atomic<uint32_t>[capacity]);
+	transform::parallel::run(capacity, threads, [&](const size_t begin, const size_t end, size_t) {
+		for (size_t s = begin; s < end; s++) { table[s].store(empty, std::memory_order_relaxed); }
+	});
+
+	// insert every position, leaving each distinct key's slot holding the lowest position with that key
+	transform::parallel::run(n, threads, [&](const size_t begin, const size_t end, size_t) {
+		for (size_t i = begin; i < end; i++) {
+			const K* key = keys + i * dimensions;
+			for (size_t s = hash_key(key, dimensions) & mask; ; s = (s + 1) & mask) {
+				// a failed claim of an empty slot leaves held with the winner, which is then checked like any other
+				uint32_t held = table[s].load();
+				if (held == empty && table[s].compare_exchange_strong(held, (uint32_t) i)) { break; }
+				if (held != empty && same(keys + (size_t) held * dimensions, key, dimensions)) {
+					while (i < held && !table[s].compare_exchange_weak(held, (uint32_t) i)) {}
+					break;
+				}
+			}
+		}
+	});
+
+	// representative of each position, and how many representatives each share holds
+	std::vector<uint32_t> rep(n);
+	const size_t workers = transform::parallel::workers(n, threads);
+	std::vector<size_t> counts(workers + 1, 0);
+	transform::parallel::run(n, threads, [&](const size_t begin, const size_t end, const size_t t) {
+		size_t c = 0;
+		for (size_t i = begin; i < end; i++) {
+			const K* key = keys + i * dimensions;
+			size_t s = hash_key(key, dimensions) & mask;
+			while (!same(keys + (size_t) table[s].load(std::memory_order_relaxed) * dimensions, key, dimensions)) {
+				s = (s + 1) & mask;
+			}
+			rep[i] = table[s].load(std::memory_order_relaxed);
+			c += (rep[i] == i);
+		}
+		counts[t + 1] = c;
+	});
+	for (size_t t = 0; t < workers; t++) { counts[t + 1] += counts[t]; }
+
+	// number the representatives in order, then point every other position at its representative's number;
+	// the representatives' own entries are only read in the second pass, never written
+	transform::parallel::run(n, threads, [&](const size_t begin, const size_t end, const size_t t) {
+		uint32_t next = (uint32_t) counts[t];
+		for (size_t i = begin; i < end; i++) {
+			if (rep[i] == i) {
+				first[next] = (uint32_t) i;
+				remap[i] = next++;
+			}
+		}
+	});
+	transform::parallel::run(n, threads, [&](const size_t begin, const size_t end, size_t) {
+		for (size_t i = begin; i < end; i++) { if (rep[i] != i) { remap[i] = remap[rep[i]]; } }
+	});
+
+	return counts[workers];
+}
+
+template size_t transform::weld<int32_t>(const int32_t*, const int, const size_t, uint32_t*, uint32_t*, const unsigned);
+template size_t transform::weld<int64_t>(const int64_t*, const int, const size_t, uint32_t*, uint32_t*, const unsigned);
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// Welds duplicate and near-duplicate positions. Each position is snapped to a grid of cell size tolerance
+	// (or taken bit for bit when tolerance is zero), and positions in the same cell become one vertex: the
+	// first of them, keeping its original value. Near-duplicates that straddle a cell boundary stay apart, and
+	// positions beyond 2^31 cells of the origin (2^63 for double) share the outermost cell on their side.
+	//
+	// Writes the distinct positions to out, in order of first occurrence, and remap[i], the index in out of
+	// position i. out may be positions itself. Returns the number of distinct positions. The result is the
+	// same for any number of threads. Throws std::length_error for 2^32 - 1 positions or more, which 32-bit
+	// remap indices cannot number.
+	template <class V>
+	size_t weld(
+		const V* positions, const size_t n, const typename V::value_type tolerance, V* out, uint32_t* remap,
+		const unsigned threads = 1
+	);
+
+	// The threading behind weld's passes: n items split into workers(n, threads) even shares, one per 65536
+	// items up to `threads`, with f(begin, end, share) run for each on its own thread (or inline for one).
+	namespace parallel
+	{
+		const size_t grain = 65536;
+
+		inline size_t workers(const size_t n, const unsigned threads)
+		{
+			return std::max<size_t>(1, std::min<size_t>(threads, n / grain));
+		}
+
+		template <class F>
+		void run(const size_t n, const unsigned threads, F f);
+	}
+
+	// The deduplication behind weld, over n keys of `dimensions` words each, with a lock-free open-addressing
+	// table. Writes remap[i], the index of key i among the distinct keys, and first[j], the first position
+	// holding distinct key j. Returns the number of distinct keys.
+	template <class K>
+	size_t weld(const K* keys, const int dimensions, const size_t n, uint32_t* remap, uint32_t* first, const unsigned threads);
+}
+
+template <class F>
+void transform::parallel::run(const size_t n, const unsigned threads, F f)
+{
+	const size_t count = workers(n, threads);
+	if (count == 1) { f(size_t(0), n, size_t(0)); return; }
+
+	std::vector<std::thread> pool;
+	const size_t share = (n + count - 1) / count;
+	for (size_t t = 0; t < count; t++) {
+		pool.emplace_back(f, std::min(n, t * share), std::min(n, (t + 1) * share), t);
+	}
+	for (std::thread& t : pool) { t.join(); }
+}
+
+template <class V>
+size_t transform::weld(
+	const V* positions, const size_t n, const typename V::value_type tolerance, V* out, uint32_t* remap,
+	const unsigned threads
+)
+{
+	typedef typename V::value_type T;
+	typedef typename std::conditional<(sizeof(T) > 4), int64_t, int32_t>::type K;
+	static_assert(std::is_floating_point<T>::value, "weld takes float or double positions");
+
+	if (n >= 0xFFFFFFFF) { throw std::length_error("transform::weld: more than 2^32 - 2 positions"); }
+
+	const int D = V::dimensions;
+	std::vector<K> keys(n * D);
+
+	// grid cell, clamped to the key range, or the element's bits with -0 folded into 0. The key range's upper
+	// end is not representable in T, so the clamp stops at the largest T below it; NaN clamps to the low end.
+	transform::parallel::run(n, threads, [&](const size_t begin, const size_t end, size_t) {
+		const T inv = (tolerance > 0) ? T(1) / tolerance : T(0);
+		const T lo = (T) std::numeric_limits<K>::min(), hi = std::nextafter(-lo, T(0));
+		for (size_t i = begin; i < end; i++) {
+			for (int k = 0; k < D; k++) {
+				T x = positions[i][k];
+				if (tolerance > 0) {
+					T cell = std::floor(x * inv + T(0.5));
+					cell = (cell > lo) ? cell : lo;
+					keys[i * D + k] = (K) ((cell < hi) ? cell : hi);
+				} else {
+					x = x + T(0);
+					std::memcpy(&keys[i * D + k], &x, sizeof(T));
+				}
+			}
+		}
+	});
+
+	std::vector<uint32_t> first(n);
+	const size_t count = weld(keys.data(), D, n, remap, first.data(), threads);
+	for (size_t j = 0; j < count; j++) {
+		for (int k = 0; k < D; k++) { out[j][k] = positions[first[j]][k]; }
+	}
+	return count;
+}
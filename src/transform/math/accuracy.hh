@@ -0,0 +1,13 @@
+#pragma once
+
+namespace transform
+{
+	// Accuracy tiers of the polynomial sine, cosine, arctangent and arccosine in math/trig.hh.
+	// Worst absolute errors against libm, in radians for angles (checked by src/test/math/trig.cc):
+	//
+	//				sin, cos	atan2		acos
+	//	FAST		2e-4		7e-4		4e-4
+	//	MEDIUM		1e-6		3e-6		2e-6
+	//	PRECISE		2e-7		4e-7		4e-7	(a few ulp)
+	enum Accuracy { FAST, MEDIUM, PRECISE };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+namespace transform
+{
+	namespace math
+	{
+		// True when <cmath> reports that std::fma is as fast as a multiply and add for T,
+		// i.e. the target has a hardware fused multiply-add instruction.
+		template <class T> struct has_fast_fma : std::false_type {};
+#ifdef FP_FAST_FMAF
+		template <> struct has_fast_fma<float> : std::true_type {};
+#endif
+#ifdef FP_FAST_FMA
+		template <> struct has_fast_fma<double> : std::true_type {};
+#endif
+#ifdef FP_FAST_FMAL
+		template <> struct has_fast_fma<long double> : std::true_type {};
+#endif
+
+		// Computes a * b + c.
+		// Fused into a single rounding when the target has hardware FMA, otherwise (or when
+		// TRANSFORM_NO_FMA is defined) a separate multiply and add, matching unfused builds bit for bit.
+		template <class T>
+		inline T fmadd(const T a, const T b, const T c)
+		{
+#ifndef TRANSFORM_NO_FMA
+			if constexpr (has_fast_fma<T>::value) {
+				return std::fma(a, b, c);
+			} else
+#endif
+			{
+				return a * b + c;
+			}
+		}
+	}
+}
@@ -0,0 +1,306 @@
+#pragma once
+
+/*
+ *	A thin layer over the widest vector registers the target supports: AVX2, SSE2, or a scalar
+ *	fallback. Kernels written against it compile to whichever the build enables (see --simd in premake5.lua).
+ */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#else
+#include <cmath>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace transform
+{
+	namespace simd
+	{
+#if defined(__AVX2__)
+		const int width = 8;
+		typedef __m256 floatv;
+
+		inline floatv zero() { return _mm256_setzero_ps(); }
+		inline floatv set1(const float s) { return _mm256_set1_ps(s); }
+		inline floatv load(const float* p) { return _mm256_loadu_ps(p); }
+		inline void store(float* p, const floatv a) { _mm256_storeu_ps(p, a); }
+
+		inline floatv add(const floatv a, const floatv b) { return _mm256_add_ps(a, b); }
+		inline floatv sub(const floatv a, const floatv b) { return _mm256_sub_ps(a, b); }
+		inline floatv mul(const floatv a, const floatv b) { return _mm256_mul_ps(a, b); }
+
+		// a * b + c
+		inline floatv madd(const floatv a, const floatv b, const floatv c)
+		{
+#if defined(__FMA__) && !defined(TRANSFORM_NO_FMA)
+			return _mm256_fmadd_ps(a, b, c);
+#else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+		}
+
+		inline floatv div(const floatv a, const floatv b) { return _mm256_div_ps(a, b); }
+		inline floatv sqrt(const floatv a) { return _mm256_sqrt_ps(a); }
+		inline floatv min(const floatv a, const floatv b) { return _mm256_min_ps(a, b); }
+		inline floatv max(const floatv a, const floatv b) { return _mm256_max_ps(a, b); }
+		inline floatv abs(const floatv a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+
+		// a with its sign flipped wherever b is negative
+		inline floatv flipsign(const floatv a, const floatv b) { return _mm256_xor_ps(a, _mm256_and_ps(b, _mm256_set1_ps(-0.0f))); }
+
+		// comparisons, all ones in a lane where true
+		typedef __m256 maskv;
+
+		inline maskv lt(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		inline maskv le(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+		inline maskv gt(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+		inline maskv ge(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+		inline maskv eq(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		inline maskv ne(const floatv a, const floatv b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+
+		inline maskv mask_and(const maskv a, const maskv b) { return _mm256_and_ps(a, b); }
+		inline maskv mask_or(const maskv a, const maskv b) { return _mm256_or_ps(a, b); }
+		inline int bits(const maskv m) { return _mm256_movemask_ps(m); }	// bit i set where lane i is true
+
+		// a where m is true, otherwise b
+		inline floatv select(const maskv m, const floatv a, const floatv b) { return _mm256_blendv_ps(b, a, m); }
+
+		// 32-bit integer lanes
+		typedef __m256i intv;
+
+		inline intv iset1(const uint32_t s) { return _mm256_set1_epi32((int) s); }
+		inline intv iload(const uint32_t* p) { return _mm256_loadu_si256((const __m256i*) p); }
+		inline void istore(uint32_t* p, const intv a) { _mm256_storeu_si256((__m256i*) p, a); }
+
+		inline intv iadd(const intv a, const intv b) { return _mm256_add_epi32(a, b); }
+		inline intv ixor(const intv a, const intv b) { return _mm256_xor_si256(a, b); }
+		inline intv iand(const intv a, const intv b) { return _mm256_and_si256(a, b); }
+		inline intv isrl(const intv a, const int n) { return _mm256_srli_epi32(a, n); }
+		inline maskv ieq(const intv a, const intv b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)); }
+
+		inline intv iround(const floatv a) { return _mm256_cvtps_epi32(a); }	// to nearest, as signed
+		inline floatv ifloat(const intv a) { return _mm256_cvtepi32_ps(a); }	// from signed
+
+		// full 64-bit products a * k, split into high and low words
+		inline void mulhilo(const intv a, const uint32_t k, intv& hi, intv& lo)
+		{
+			const __m256i kk = _mm256_set1_epi32((int) k);
+			__m256i even = _mm256_mul_epu32(a, kk);
+			__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), kk);
+			lo = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, 0x08), _mm256_shuffle_epi32(odd, 0x08));
+			hi = _mm256_unpacklo_epi32(_mm256_shuffle_epi32(even, 0x0d), _mm256_shuffle_epi32(odd, 0x0d));
+		}
+
+		inline float hsum(const floatv a)
+		{
+			__m128 s = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+			s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+			s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+			return _mm_cvtss_f32(s);
+		}
+#elif defined(__SSE2__)
+		const int width = 4;
+		typedef __m128 floatv;
+
+		inline floatv zero() { return _mm_setzero_ps(); }
+		inline floatv set1(const float s) { return _mm_set1_ps(s); }
+		inline floatv load(const float* p) { return _mm_loadu_ps(p); }
+		inline void store(float* p, const floatv a) { _mm_storeu_ps(p, a); }
+
+		inline floatv add(const floatv a, const floatv b) { return _mm_add_ps(a, b); }
+		inline floatv sub(const floatv a, const floatv b) { return _mm_sub_ps(a, b); }
+		inline floatv mul(const floatv a, const floatv b) { return _mm_mul_ps(a, b); }
+
+		// a * b + c
+		inline floatv madd(const floatv a, const floatv b, const floatv c)
+		{
+			return _mm_add_ps(_mm_mul_ps(a, b), c);
+		}
+
+		inline floatv div(const floatv a, const floatv b) { return _mm_div_ps(a, b); }
+		inline floatv sqrt(const floatv a) { return _mm_sqrt_ps(a); }
+		inline floatv min(const floatv a, const floatv b) { return _mm_min_ps(a, b); }
+		inline floatv max(const floatv a, const floatv b) { return _mm_max_ps(a, b); }
+		inline floatv abs(const floatv a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+
+		// a with its sign flipped wherever b is negative
+		inline floatv flipsign(const floatv a, const floatv b) { return _mm_xor_ps(a, _mm_and_ps(b, _mm_set1_ps(-0.0f))); }
+
+		// comparisons, all ones in a lane where true
+		typedef __m128 maskv;
+
+		inline maskv lt(const floatv a, const floatv b) { return _mm_cmplt_ps(a, b); }
+		inline maskv le(const floatv a, const floatv b) { return _mm_cmple_ps(a, b); }
+		inline maskv gt(const floatv a, const floatv b) { return _mm_cmpgt_ps(a, b); }
+		inline maskv ge(const floatv a, const floatv b) { return _mm_cmpge_ps(a, b); }
+		inline maskv eq(const floatv a, const floatv b) { return _mm_cmpeq_ps(a, b); }
+		inline maskv ne(const floatv a, const floatv b) { return _mm_cmpneq_ps(a, b); }
+
+		inline maskv mask_and(const maskv a, const maskv b) { return _mm_and_ps(a, b); }
+		inline maskv mask_or(const maskv a, const maskv b) { return _mm_or_ps(a, b); }
+		inline int bits(const maskv m) { return _mm_movemask_ps(m); }	// bit i set where lane i is true
+
+		// a where m is true, otherwise b
+		inline floatv select(const maskv m, const floatv a, const floatv b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+		// 32-bit integer lanes
+		typedef __m128i intv;
+
+		inline intv iset1(const uint32_t s) { return _mm_set1_epi32((int) s); }
+		inline intv iload(const uint32_t* p) { return _mm_loadu_si128((const __m128i*) p); }
+		inline void istore(uint32_t* p, const intv a) { _mm_storeu_si128((__m128i*) p, a); }
+
+		inline intv iadd(const intv a, const intv b) { return _mm_add_epi32(a, b); }
+		inline intv ixor(const intv a, const intv b) { return _mm_xor_si128(a, b); }
+		inline intv iand(const intv a, const intv b) { return _mm_and_si128(a, b); }
+		inline intv isrl(const intv a, const int n) { return _mm_srli_epi32(a, n); }
+		inline maskv ieq(const intv a, const intv b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+
+		inline intv iround(const floatv a) { return _mm_cvtps_epi32(a); }	// to nearest, as signed
+		inline floatv ifloat(const intv a) { return _mm_cvtepi32_ps(a); }	// from signed
+
+		// full 64-bit products a * k, split into high and low words
+		inline void mulhilo(const intv a, const uint32_t k, intv& hi, intv& lo)
+		{
+			const __m128i kk = _mm_set1_epi32((int) k);
+			__m128i even = _mm_mul_epu32(a, kk);
+			__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), kk);
+			lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+			hi = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x0d), _mm_shuffle_epi32(odd, 0x0d));
+		}
+
+		inline float hsum(const floatv a)
+		{
+			__m128 s = _mm_add_ps(a, _mm_movehl_ps(a, a));
+			s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+			return _mm_cvtss_f32(s);
+		}
+#else
+		const int width = 1;
+		typedef float floatv;
+
+		inline floatv zero() { return 0.0f; }
+		inline floatv set1(const float s) { return s; }
+		inline floatv load(const float* p) { return *p; }
+		inline void store(float* p, const floatv a) { *p = a; }
+
+		inline floatv add(const floatv a, const floatv b) { return a + b; }
+		inline floatv sub(const floatv a, const floatv b) { return a - b; }
+		inline floatv mul(const floatv a, const floatv b) { return a * b; }
+
+		// a * b + c
+		inline floatv madd(const floatv a, const floatv b, const floatv c) { return a * b + c; }
+
+		inline floatv div(const floatv a, const floatv b) { return a / b; }
+		inline floatv sqrt(const floatv a) { return std::sqrt(a); }
+		inline floatv min(const floatv a, const floatv b) { return (b < a) ? b : a; }
+		inline floatv max(const floatv a, const floatv b) { return (a < b) ? b : a; }
+		inline floatv abs(const floatv a) { return std::fabs(a); }
+
+		// a with its sign flipped wherever b is negative
+		inline floatv flipsign(const floatv a, const floatv b) { return std::signbit(b) ? -a : a; }
+
+		// comparisons
+		typedef bool maskv;
+
+		inline maskv lt(const floatv a, const floatv b) { return a < b; }
+		inline maskv le(const floatv a, const floatv b) { return a <= b; }
+		inline maskv gt(const floatv a, const floatv b) { return a > b; }
+		inline maskv ge(const floatv a, const floatv b) { return a >= b; }
+		inline maskv eq(const floatv a, const floatv b) { return a == b; }
+		inline maskv ne(const floatv a, const floatv b) { return a != b; }
+
+		inline maskv mask_and(const maskv a, const maskv b) { return a && b; }
+		inline maskv mask_or(const maskv a, const maskv b) { return a || b; }
+		inline int bits(const maskv m) { return m ? 1 : 0; }	// bit i set where lane i is true
+
+		// a where m is true, otherwise b
+		inline floatv select(const maskv m, const floatv a, const floatv b) { return m ? a : b; }
+
+		// 32-bit integer lanes
+		typedef uint32_t intv;
+
+		inline intv iset1(const uint32_t s) { return s; }
+		inline intv iload(const uint32_t* p) { return *p; }
+		inline void istore(uint32_t* p, const intv a) { *p = a; }
+
+		inline intv iadd(const intv a, const intv b) { return a + b; }
+		inline intv ixor(const intv a, const intv b) { return a ^ b; }
+		inline intv iand(const intv a, const intv b) { return a & b; }
+		inline intv isrl(const intv a, const int n) { return a >> n; }
+		inline maskv ieq(const intv a, const intv b) { return a == b; }
+
+		inline intv iround(const floatv a) { return (uint32_t) (int32_t) std::nearbyint(a); }	// to nearest, as signed
+		inline floatv ifloat(const intv a) { return (float) (int32_t) a; }							// from signed
+
+		// full 64-bit products a * k, split into high and low words
+		inline void mulhilo(const intv a, const uint32_t k, intv& hi, intv& lo)
+		{
+			uint64_t p = (uint64_t) a * k;
+			hi = (uint32_t) (p >> 32);
+			lo = (uint32_t) p;
+		}
+
+		inline float hsum(const floatv a) { return a; }
+#endif
+
+		// the first n lanes at p, or a whole register if n >= width; lanes past n load as zero
+		inline floatv load(const float* p, const size_t n)
+		{
+			if (n >= (size_t) width) { return load(p); }
+			float t[width] = {};
+			for (size_t l = 0; l < n; l++) { t[l] = p[l]; }
+			return load(t);
+		}
+
+		// stores the first n lanes of a, or all of them if n >= width
+		inline void store(float* p, const floatv a, const size_t n)
+		{
+			if (n >= (size_t) width) { store(p, a); return; }
+			float t[width];
+			store(t, a);
+			for (size_t l = 0; l < n; l++) { p[l] = t[l]; }
+		}
+
+		const size_t chunk = 256;
+
+		// Runs kernel(c, i, m) over n float vectors in chunks of at most `chunk`, with c[k][j] component k of
+		// vector i + j: gathered from in, or zero when in is null. Writes the first D components back to out.
+		template <int D, class V, class F>
+		void chunked(const V* in, V* out, const size_t n, F kernel)
+		{
+			static_assert(std::is_same<typename V::value_type, float>::value, "chunked takes float vectors");
+			static_assert(D <= V::dimensions, "more component arrays than vector components");
+
+			float c[D][chunk];
+			float* p[D];
+			for (int k = 0; k < D; k++) { p[k] = c[k]; }
+			if (!in) {
+				for (int k = 0; k < D; k++) {
+					for (size_t j = 0; j < n && j < chunk; j++) { c[k][j] = 0.0f; }
+				}
+			}
+
+			for (size_t i = 0; i < n; i += chunk) {
+				const size_t m = (n - i < chunk) ? n - i : chunk;
+				if (in) {
+					for (size_t j = 0; j < m; j++) {
+						for (int k = 0; k < D; k++) { c[k][j] = in[i + j][k]; }
+					}
+				}
+				kernel((float* const*) p, i, m);
+				for (size_t j = 0; j < m; j++) {
+					for (int k = 0; k < D; k++) { out[i + j][k] = c[k][j]; }
+				}
+			}
+		}
+
+		template <int D, class V, class F>
+		void chunked(V* out, const size_t n, F kernel) { chunked<D>((const V*) nullptr, out, n, kernel); }
+	}
+}
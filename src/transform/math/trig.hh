@@ -0,0 +1,125 @@
+#pragma once
+
+/*
+ *	Polynomial sine, cosine, arctangent and arccosine over SIMD lanes, at the accuracy tiers of math/accuracy.hh.
+ *	Sine and cosine reduce the argument to [-pi/4, pi/4] by the nearest multiple of pi/2 in three parts, which
+ *	holds the PRECISE bounds for |x| up to a few thousand. PRECISE uses the single precision Cephes polynomials;
+ *	FAST and MEDIUM use shorter minimax fits.
+ */
+
+#include "accuracy.hh"
+#include "simd.hh"
+
+namespace transform
+{
+	namespace simd
+	{
+		template <Accuracy A = PRECISE>
+		inline void sincos(const floatv x, floatv& s, floatv& c)
+		{
+			intv q = iround(mul(x, set1(0.636619772367581343f)));	// x * 2 / pi
+			floatv fq = ifloat(q);
+
+			floatv r = simd::madd(fq, set1(-1.5703125f), x);
+			r = simd::madd(fq, set1(-4.837512969970703125e-4f), r);
+			r = simd::madd(fq, set1(-7.54978995489188216e-8f), r);
+			floatv r2 = mul(r, r);
+
+			floatv ps, pc;
+			if constexpr (A == FAST) {
+				ps = mul(simd::madd(r2, set1(-1.6034401672e-1f), set1(9.9903142291e-1f)), r);
+				pc = simd::madd(simd::madd(r2, set1(4.0398535969e-2f), set1(-4.9970814036e-1f)), r2, set1(9.9999003496e-1f));
+			} else if constexpr (A == MEDIUM) {
+				ps = simd::madd(r2, set1(8.1215579246e-3f), set1(-1.6660161988e-1f));
+				ps = mul(simd::madd(ps, r2, set1(9.9999499756e-1f)), r);
+				pc = simd::madd(r2, set1(-1.3585908511e-3f), set1(4.1655026884e-2f));
+				pc = simd::madd(pc, r2, set1(-4.9999856696e-1f));
+				pc = simd::madd(pc, r2, set1(9.9999997242e-1f));
+			} else {
+				ps = simd::madd(r2, set1(-1.9515295891e-4f), set1(8.3321608736e-3f));
+				ps = simd::madd(ps, r2, set1(-1.6666654611e-1f));
+				ps = simd::madd(mul(ps, r2), r, r);
+				pc = simd::madd(r2, set1(2.443315711809948e-5f), set1(-1.388731625493765e-3f));
+				pc = simd::madd(pc, r2, set1(4.166664568298827e-2f));
+				pc = simd::madd(mul(pc, r2), r2, simd::madd(r2, set1(-0.5f), set1(1.0f)));
+			}
+
+			// quadrant q: odd quadrants swap sine and cosine, then signs follow q & 2 and (q + 1) & 2
+			const intv one = iset1(1), two = iset1(2);
+			maskv odd = ieq(iand(q, one), one);
+			floatv sn = select(odd, pc, ps);
+			floatv cs = select(odd, ps, pc);
+			const floatv plus = set1(1.0f), minus = set1(-1.0f);
+			s = flipsign(sn, select(ieq(iand(q, two), two), minus, plus));
+			c = flipsign(cs, select(ieq(iand(iadd(q, one), two), two), minus, plus));
+		}
+
+		// Angle of (x, y) in [-pi, pi], zero at the origin. The sign of y carries through as in libm, but a
+		// negative zero x counts as positive, so atan2(0, -0) is 0 rather than pi.
+		template <Accuracy A = PRECISE>
+		inline floatv atan2(const floatv y, const floatv x)
+		{
+			const floatv ax = abs(x), ay = abs(y);
+			const floatv hi = max(ax, ay), lo = min(ax, ay);
+			floatv t = div(lo, select(gt(hi, zero()), hi, set1(1.0f)));	// in [0, 1]
+			floatv a;
+
+			if constexpr (A == FAST) {
+				floatv t2 = mul(t, t);
+				a = simd::madd(t2, set1(7.9339041419e-2f), set1(-2.8869023801e-1f));
+				a = mul(simd::madd(a, t2, set1(9.9535795475e-1f)), t);
+			} else if constexpr (A == MEDIUM) {
+				floatv t2 = mul(t, t);
+				a = simd::madd(t2, set1(-1.1719135734e-2f), set1(5.2647351466e-2f));
+				a = simd::madd(a, t2, set1(-1.1642648197e-1f));
+				a = simd::madd(a, t2, set1(1.9354037608e-1f));
+				a = simd::madd(a, t2, set1(-3.3262282789e-1f));
+				a = mul(simd::madd(a, t2, set1(9.9997721908e-1f)), t);
+			} else {
+				// above tan(pi / 8), atan(t) = pi / 4 + atan((t - 1) / (t + 1))
+				maskv upper = gt(t, set1(0.414213562373095f));
+				floatv u = select(upper, div(sub(t, set1(1.0f)), add(t, set1(1.0f))), t);
+				floatv u2 = mul(u, u);
+				a = simd::madd(u2, set1(8.05374449538e-2f), set1(-1.38776856032e-1f));
+				a = simd::madd(a, u2, set1(1.99777106478e-1f));
+				a = simd::madd(a, u2, set1(-3.33329491539e-1f));
+				a = simd::madd(mul(a, u2), u, u);
+				a = add(a, select(upper, set1(0.785398163397448f), zero()));
+			}
+
+			a = select(gt(ay, ax), sub(set1(1.57079632679489662f), a), a);
+			a = select(lt(x, zero()), sub(set1(3.14159265358979324f), a), a);
+			return flipsign(a, y);
+		}
+
+		// Arccosine of x in [-1, 1], as sqrt(1 - |x|) times a polynomial in |x|, reflected for negative x.
+		template <Accuracy A = PRECISE>
+		inline floatv acos(const floatv x)
+		{
+			const floatv ax = min(abs(x), set1(1.0f));
+			floatv p;
+
+			if constexpr (A == FAST) {
+				p = simd::madd(ax, set1(5.1389535351e-2f), set1(-2.0549754210e-1f));
+				p = simd::madd(p, ax, set1(1.5704702614f));
+			} else if constexpr (A == MEDIUM) {
+				p = simd::madd(ax, set1(-4.9111744548e-3f), set1(2.0620061670e-2f));
+				p = simd::madd(p, ax, set1(-4.5927228734e-2f));
+				p = simd::madd(p, ax, set1(8.8171053564e-2f));
+				p = simd::madd(p, ax, set1(-2.1454281678e-1f));
+				p = simd::madd(p, ax, set1(1.5707956895f));
+			} else {
+				p = simd::madd(ax, set1(-1.4414806765e-3f), set1(7.2454505385e-3f));
+				p = simd::madd(p, ax, set1(-1.7808987226e-2f));
+				p = simd::madd(p, ax, set1(3.1335472071e-2f));
+				p = simd::madd(p, ax, set1(-5.0312784931e-2f));
+				p = simd::madd(p, ax, set1(8.8999264917e-2f));
+				p = simd::madd(p, ax, set1(-2.1459989244e-1f));
+				p = simd::madd(p, ax, set1(1.5707963143f));
+			}
+
+			floatv a = mul(sqrt(sub(set1(1.0f), ax)), p);
+			return select(lt(x, zero()), sub(set1(3.14159265358979324f), a), a);
+		}
+	}
+}
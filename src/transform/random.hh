@@ -0,0 +1,4 @@
+#pragma once
+
+#include "random/random.hh"
+#include "random/sample.hh"
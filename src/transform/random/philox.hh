@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+ *	The Philox4x32-10 rounds over SIMD lanes, one block counter per lane, shared by the generator and the samplers.
+ */
+
+#include "random.hh"
+#include "../math/simd.hh"
+
+namespace transform
+{
+	const uint32_t philox_m0 = 0xD2511F53, philox_m1 = 0xCD9E8D57;	// round multipliers
+	const uint32_t philox_w0 = 0x9E3779B9, philox_w1 = 0xBB67AE85;	// key increments
+
+	namespace simd
+	{
+		// Blocks position, position + stride, ... of rng's stream, one per lane, word k of every block in out[k].
+		inline void philox(const Random& rng, const uint64_t position, intv (&out)[4], const uint64_t stride = 1)
+		{
+			uint32_t lo[width], hi[width];
+			for (int l = 0; l < width; l++) {
+				lo[l] = (uint32_t) (position + l * stride);
+				hi[l] = (uint32_t) ((position + l * stride) >> 32);
+			}
+
+			intv c0 = iload(lo), c1 = iload(hi);
+			intv c2 = iset1((uint32_t) rng.stream()), c3 = iset1((uint32_t) (rng.stream() >> 32));
+			uint32_t k0 = (uint32_t) rng.seed(), k1 = (uint32_t) (rng.seed() >> 32);
+
+			for (int round = 0; round < 10; round++) {
+				intv hi0, lo0, hi1, lo1;
+				mulhilo(c0, philox_m0, hi0, lo0);
+				mulhilo(c2, philox_m1, hi1, lo1);
+				c0 = ixor(ixor(hi1, c1), iset1(k0));
+				c1 = lo1;
+				c2 = ixor(ixor(hi0, c3), iset1(k1));
+				c3 = lo0;
+				k0 += philox_w0;
+				k1 += philox_w1;
+			}
+
+			out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+		}
+
+		// the top 24 bits of each word as a float in [0, 1)
+		inline floatv unit(const intv a) { return mul(ifloat(isrl(a, 8)), set1(1.0f / 16777216)); }
+	}
+}
@@ -0,0 +1,72 @@
+#include "random.hh"
+
+#include "philox.hh"
+
+using transform::Random;
+
+Random::Random(const uint64_t seed, const uint64_t stream) : _seed(seed), _stream(stream), _position(0) {}
+
+uint64_t Random::advance(const uint64_t blocks)
+{
+	uint64_t position = _position;
+	_position += blocks;
+	return position;
+}
+
+void Random::generate(uint32_t* out, const size_t blocks)
+{
+	using namespace transform::simd;
+
+	const uint64_t position = advance(blocks);
+	for (size_t i = 0; i < blocks; i += width) {
+		intv r[4];
+		simd::philox(*this, position + i, r);
+
+		uint32_t w[4][width];
+		for (int k = 0; k < 4; k++) { istore(w[k], r[k]); }
+		const size_t n = (blocks - i < (size_t) width) ? blocks - i : width;
+		for (size_t l = 0; l < n; l++) {
+			for (int k = 0; k < 4; k++) { out[(i + l) * 4 + k] = w[k][l]; }
+		}
+	}
+}
+
+void Random::uniform(float* out, const size_t n)
+{
+	using namespace transform::simd;
+
+	const size_t blocks = (n + 3) / 4;
+	const uint64_t position = advance(blocks);
+	for (size_t i = 0; i < blocks; i += width) {
+		intv r[4];
+		simd::philox(*this, position + i, r);
+
+		float u[4][width];
+		for (int k = 0; k < 4; k++) { store(u[k], unit(r[k])); }
+		const size_t m = (blocks - i < (size_t) width) ? blocks - i : width;
+		for (size_t l = 0; l < m; l++) {
+			for (int k = 0; k < 4; k++) {
+				size_t j = (i + l) * 4 + k;
+				if (j < n) { out[j] = u[k][l]; }
+			}
+		}
+	}
+}
+
+void Random::philox(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4])
+{
+	uint32_t c[4] = { counter[0], counter[1], counter[2], counter[3] };
+	uint32_t k0 = key[0], k1 = key[1];
+	for (int round = 0; round < 10; round++) {
+		uint64_t p0 = (uint64_t) transform::philox_m0 * c[0];
+		uint64_t p1 = (uint64_t) transform::philox_m1 * c[2];
+		uint32_t n[4] = {
+			(uint32_t) (p1 >> 32) ^ c[1] ^ k0, (uint32_t) p1,
+			(uint32_t) (p0 >> 32) ^ c[3] ^ k1, (uint32_t) p0
+		};
+		for (int k = 0; k < 4; k++) { c[k] = n[k]; }
+		k0 += transform::philox_w0;
+		k1 += transform::philox_w1;
+	}
+	for (int k = 0; k < 4; k++) { out[k] = c[k]; }
+}
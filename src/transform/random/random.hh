@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace transform
+{
+	// Philox4x32-10, the counter-based generator of Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3".
+	// Each 128-bit block is a pure function of the seed, the stream, and the block's position, so a generator can
+	// seek anywhere in O(1), and workers given separate streams, or separate ranges of one stream, draw
+	// independent and reproducible numbers however the work is split.
+	class Random
+	{
+	public:
+		Random(const uint64_t seed = 0, const uint64_t stream = 0);
+
+		uint64_t seed() const { return _seed; }
+		uint64_t stream() const { return _stream; }
+
+		uint64_t tell() const { return _position; }				// position, in blocks
+		void seek(const uint64_t position) { _position = position; }
+		uint64_t advance(const uint64_t blocks);				// skips ahead, returning the old position
+
+		void generate(uint32_t* out, const size_t blocks);		// four words per block
+		void uniform(float* out, const size_t n);				// in [0, 1), one per word
+
+		// block counter of a stream keyed by key, without the generator
+		static void philox(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+	private:
+		uint64_t _seed;
+		uint64_t _stream;
+		uint64_t _position;
+	};
+}
@@ -0,0 +1,91 @@
+#include "sample.hh"
+
+#include "philox.hh"
+#include "../math/trig.hh"
+
+using namespace transform::simd;
+using transform::Random;
+
+namespace
+{
+	const float two_pi = 6.28318530717958648f;
+
+	// Calls f(r, i) with the blocks for samples i to i + width - 1, for every i up to n.
+	template <class F>
+	inline void blocks(Random& rng, const size_t n, F f)
+	{
+		const uint64_t position = rng.advance(n);
+		for (size_t i = 0; i < n; i += width) {
+			intv r[4];
+			philox(rng, position + i, r);
+			f(r, i);
+		}
+	}
+
+	// a point on the unit circle, scaled by rho
+	inline void circle(const floatv rho, const intv r, floatv& x, floatv& y)
+	{
+		floatv s, c;
+		sincos(mul(unit(r), set1(two_pi)), s, c);
+		x = mul(rho, c);
+		y = mul(rho, s);
+	}
+}
+
+void transform::sample::box(Random& rng, const float* lo, const float* hi, const int dimensions, float* const* out, const size_t n)
+{
+	// sample i takes words 4 j to 4 j + 3 from block tell() + i * per + j
+	const size_t per = (dimensions + 3) / 4;
+	const uint64_t position = rng.advance(n * per);
+	for (size_t i = 0; i < n; i += width) {
+		for (size_t j = 0; j < per; j++) {
+			intv r[4];
+			philox(rng, position + i * per + j, r, per);
+			for (int k = (int) j * 4; k < dimensions && k < (int) j * 4 + 4; k++) {
+				store(out[k] + i, simd::madd(unit(r[k % 4]), set1(hi[k] - lo[k]), set1(lo[k])), n - i);
+			}
+		}
+	}
+}
+
+void transform::sample::sphere(Random& rng, float* x, float* y, float* z, const size_t n)
+{
+	blocks(rng, n, [&](const intv (&r)[4], const size_t i) {
+		floatv h = simd::madd(unit(r[0]), set1(-2.0f), set1(1.0f));
+		floatv rho = sqrt(max(simd::madd(h, sub(zero(), h), set1(1.0f)), zero()));
+		floatv px, py;
+		circle(rho, r[1], px, py);
+		store(x + i, px, n - i); store(y + i, py, n - i); store(z + i, h, n - i);
+	});
+}
+
+void transform::sample::hemisphere(Random& rng, float* x, float* y, float* z, const size_t n)
+{
+	blocks(rng, n, [&](const intv (&r)[4], const size_t i) {
+		floatv h = sub(set1(1.0f), unit(r[0]));
+		floatv rho = sqrt(max(simd::madd(h, sub(zero(), h), set1(1.0f)), zero()));
+		floatv px, py;
+		circle(rho, r[1], px, py);
+		store(x + i, px, n - i); store(y + i, py, n - i); store(z + i, h, n - i);
+	});
+}
+
+void transform::sample::cosine(Random& rng, float* x, float* y, float* z, const size_t n)
+{
+	// Malley's method: project uniform disk points up onto the hemisphere
+	blocks(rng, n, [&](const intv (&r)[4], const size_t i) {
+		floatv u = unit(r[0]);
+		floatv px, py;
+		circle(sqrt(u), r[1], px, py);
+		store(x + i, px, n - i); store(y + i, py, n - i); store(z + i, sqrt(sub(set1(1.0f), u)), n - i);
+	});
+}
+
+void transform::sample::disk(Random& rng, float* x, float* y, const size_t n)
+{
+	blocks(rng, n, [&](const intv (&r)[4], const size_t i) {
+		floatv px, py;
+		circle(sqrt(unit(r[0])), r[1], px, py);
+		store(x + i, px, n - i); store(y + i, py, n - i);
+	});
+}
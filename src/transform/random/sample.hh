@@ -0,0 +1,81 @@
+#pragma once
+
+#include "random.hh"
+#include "../math/simd.hh"
+#include "../vector.hh"
+
+namespace transform
+{
+	// Bulk samplers. Every sample draws one block from the generator, so sample i of a call always comes from
+	// block tell() + i, whatever the SIMD width, and splitting a fill into several calls, or across workers
+	// that seek to their own ranges, gives the same values as one call. Boxes of more than four dimensions
+	// are the exception: they draw one block per four dimensions, so sample i starts at tell() + i * per.
+	namespace sample
+	{
+		// structure-of-arrays kernels
+		void box(Random&, const float* lo, const float* hi, const int dimensions, float* const* out, const size_t n);
+		void sphere(Random&, float* x, float* y, float* z, const size_t n);			// on the unit sphere
+		void hemisphere(Random&, float* x, float* y, float* z, const size_t n);		// on the unit hemisphere about +z
+		void cosine(Random&, float* x, float* y, float* z, const size_t n);			// cosine-weighted about +z
+		void disk(Random&, float* x, float* y, const size_t n);						// in the unit disk
+
+		// The same into arrays of float vectors. Directions fill the first three components of a Vector4
+		// and leave w zero, and disk points leave all but x and y zero.
+		template <class V>
+		void box(Random&, const V& lo, const V& hi, V* out, const size_t n);		// in the box lo to hi
+		template <class V>
+		void sphere(Random&, V* out, const size_t n);
+		template <class V>
+		void hemisphere(Random&, V* out, const size_t n);
+		template <class V>
+		void cosine(Random&, V* out, const size_t n);
+		template <class V>
+		void disk(Random&, V* out, const size_t n);
+	}
+}
+
+template <class V>
+void transform::sample::box(Random& rng, const V& lo, const V& hi, V* out, const size_t n)
+{
+	float l[V::dimensions], h[V::dimensions];
+	for (int k = 0; k < V::dimensions; k++) { l[k] = lo[k]; h[k] = hi[k]; }
+	simd::chunked<V::dimensions>(out, n, [&](float* const* p, size_t, const size_t m) {
+		box(rng, l, h, V::dimensions, p, m);
+	});
+}
+
+template <class V>
+void transform::sample::sphere(Random& rng, V* out, const size_t n)
+{
+	static_assert(V::dimensions >= 3, "directions need three components");
+	simd::chunked<V::dimensions>(out, n, [&](float* const* p, size_t, const size_t m) {
+		sphere(rng, p[0], p[1], p[2], m);
+	});
+}
+
+template <class V>
+void transform::sample::hemisphere(Random& rng, V* out, const size_t n)
+{
+	static_assert(V::dimensions >= 3, "directions need three components");
+	simd::chunked<V::dimensions>(out, n, [&](float* const* p, size_t, const size_t m) {
+		hemisphere(rng, p[0], p[1], p[2], m);
+	});
+}
+
+template <class V>
+void transform::sample::cosine(Random& rng, V* out, const size_t n)
+{
+	static_assert(V::dimensions >= 3, "directions need three components");
+	simd::chunked<V::dimensions>(out, n, [&](float* const* p, size_t, const size_t m) {
+		cosine(rng, p[0], p[1], p[2], m);
+	});
+}
+
+template <class V>
+void transform::sample::disk(Random& rng, V* out, const size_t n)
+{
+	static_assert(V::dimensions >= 2, "disk points need two components");
+	simd::chunked<V::dimensions>(out, n, [&](float* const* p, size_t, const size_t m) {
+		disk(rng, p[0], p[1], m);
+	});
+}
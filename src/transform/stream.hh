@@ -0,0 +1,15 @@
+#pragma once
+
+#include "stream/pipeline.hh"
+
+namespace transform
+{
+	typedef Pipeline<2, float>		Pipeline2f;
+	typedef Pipeline<2, double>		Pipeline2d;
+
+	typedef Pipeline<3, float>		Pipeline3f;
+	typedef Pipeline<3, double>		Pipeline3d;
+
+	typedef Pipeline<4, float>		Pipeline4f;
+	typedef Pipeline<4, double>		Pipeline4d;
+}
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// A chain of bulk stages run over a stream of packed Vector<N, T> records, one fixed-size chunk at a time.
+	// While a chunk is processed, a worker thread writes out the previous chunk and reads the next one into the
+	// second buffer, so memory use stays at two chunks regardless of input size. Read and write errors, and
+	// a stream ending mid-record, are thrown from run as std::runtime_error.
+	//
+	// The built-in stages keep no scratch state, so a const Pipeline may run on several streams at once;
+	// reduce and bounds then share their accumulators, which the caller must guard.
+	template <int N, class T>
+	class Pipeline
+	{
+	public:
+		typedef Vector<N, T> record;
+		typedef std::function<size_t(record*, size_t)> stage;	// processes n records in place, returns records kept
+
+	private:
+		size_t _chunk;
+		std::vector<stage> _stages;
+
+		static size_t read(std::istream& in, record* data, const size_t n);
+		static void write(std::ostream* out, const record* data, const size_t n);
+
+	public:
+		explicit Pipeline(const size_t chunk = 1 << 16);	// chunk size in records
+
+		// stages
+		Pipeline<N, T>& then(const stage& s);
+
+		template <class F>
+		Pipeline<N, T>& map(F f);						// f(record&), transform each record
+
+		template <class F>
+		Pipeline<N, T>& filter(F f);					// f(const record&) -> bool, keep records where true
+
+		template <class A, class F>
+		Pipeline<N, T>& reduce(A& acc, F f);			// acc = f(acc, const record&), records pass through
+
+		Pipeline<N, T>& bounds(record& lo, record& hi);	// element-wise min and max, lo and hi must be seeded
+
+		// execution
+		size_t process(record* data, const size_t n) const;		// run every stage over one chunk
+		size_t run(std::istream& in, std::ostream* out) const;	// returns records written
+	};
+}
+
+using transform::Pipeline;
+
+template <int N, class T>
+Pipeline<N, T>::Pipeline(const size_t chunk) : _chunk(chunk ? chunk : 1)
+{
+	static_assert(sizeof(record) == N * sizeof(T), "records must be packed");
+}
+
+template <int N, class T>
+Pipeline<N, T>& Pipeline<N, T>::then(const stage& s)
+{
+	_stages.push_back(s);
+	return *this;
+}
+
+template <int N, class T>
+template <class F>
+Pipeline<N, T>& Pipeline<N, T>::map(F f)
+{
+	return then([f](record* data, size_t n) {
+		for (size_t i = 0; i < n; i++) { f(data[i]); }
+		return n;
+	});
+}
+
+// Builds the mask in one pass and compacts in a second, so the predicate loop carries no stores to data. The
+// mask covers a block at a time and lives on the stack, so concurrent runs share nothing.
+template <int N, class T>
+template <class F>
+Pipeline<N, T>& Pipeline<N, T>::filter(F f)
+{
+	return then([f](record* data, size_t n) {
+		const size_t block = 256;
+		unsigned char mask[block];
+
+		size_t kept = 0;
+		for (size_t b = 0; b < n; b += block) {
+			const size_t m = (n - b < block) ? n - b : block;
+			for (size_t i = 0; i < m; i++) { mask[i] = f(data[b + i]) ? 1 : 0; }
+			for (size_t i = 0; i < m; i++) {
+				if (mask[i]) {
+					if (kept != b + i) { data[kept] = data[b + i]; }
+					kept++;
+				}
+			}
+		}
+		return kept;
+	});
+}
+
+template <int N, class T>
+template <class A, class F>
+Pipeline<N, T>& Pipeline<N, T>::reduce(A& acc, F f)
+{
+	A* a = &acc;
+	return then([a, f](record* data, size_t n) {
+		for (size_t i = 0; i < n; i++) { *a = f(*a, data[i]); }
+		return n;
+	});
+}
+
+template <int N, class T>
+Pipeline<N, T>& Pipeline<N, T>::bounds(record& lo, record& hi)
+{
+	record* l = &lo;
+	record* h = &hi;
+	return then([l, h](record* data, size_t n) {
+		T* lp = l->ptr();
+		T* hp = h->ptr();
+		for (size_t i = 0; i < n; i++) {
+			const T* p = data[i].ptr();
+			for (int k = 0; k < N; k++) {
+				lp[k] = (p[k] < lp[k]) ? p[k] : lp[k];
+				hp[k] = (p[k] > hp[k]) ? p[k] : hp[k];
+			}
+		}
+		return n;
+	});
+}
+
+template <int N, class T>
+size_t Pipeline<N, T>::process(record* data, const size_t n) const
+{
+	size_t kept = n;
+	for (const stage& s : _stages) { kept = s(data, kept); }
+	return kept;
+}
+
+template <int N, class T>
+size_t Pipeline<N, T>::read(std::istream& in, record* data, const size_t n)
+{
+	// a stream that failed before reaching its end (one that never opened, say) is an error, not an empty one
+	if (in.fail() && !in.eof()) { throw std::runtime_error("transform::Pipeline: read failed"); }
+	if (in.eof()) { return 0; }
+
+	in.read(reinterpret_cast<char*>(data), n * sizeof(record));
+	if (in.bad()) { throw std::runtime_error("transform::Pipeline: read failed"); }
+	size_t bytes = (size_t) in.gcount();
+	if (bytes % sizeof(record)) { throw std::runtime_error("transform::Pipeline: truncated record"); }
+	return bytes / sizeof(record);
+}
+
+template <int N, class T>
+void Pipeline<N, T>::write(std::ostream* out, const record* data, const size_t n)
+{
+	if (!out || !n) { return; }
+	out->write(reinterpret_cast<const char*>(data), n * sizeof(record));
+	if (!*out) { throw std::runtime_error("transform::Pipeline: write failed"); }
+}
+
+// One worker thread lives for the whole run. Each round it is handed the back buffer, writes the records
+// processed last round from it, and refills it from the stream, while this thread processes the front one.
+template <int N, class T>
+size_t Pipeline<N, T>::run(std::istream& in, std::ostream* out) const
+{
+	std::vector<record> front(_chunk), back(_chunk);
+	size_t front_n = read(in, front.data(), _chunk);
+	size_t back_n = 0;	// processed records in back, waiting to be written
+	size_t written = 0;
+
+	std::mutex lock;
+	std::condition_variable signal;
+	bool busy = false, done = false;
+	size_t read_n = 0;
+	std::exception_ptr error;
+
+	std::thread worker([&] {
+		std::unique_lock<std::mutex> held(lock);
+		while (true) {
+			signal.wait(held, [&] { return busy || done; });
+			if (!busy) { return; }
+
+			held.unlock();
+			size_t n = 0;
+			std::exception_ptr e;
+			try {
+				write(out, back.data(), back_n);
+				n = read(in, back.data(), _chunk);
+			} catch (...) {
+				e = std::current_exception();
+			}
+			held.lock();
+
+			read_n = n;
+			error = e;
+			busy = false;
+			signal.notify_all();
+		}
+	});
+
+	// waits out the worker's round, if any, then lets it exit
+	auto stop = [&] {
+		{
+			std::unique_lock<std::mutex> held(lock);
+			signal.wait(held, [&] { return !busy; });
+			done = true;
+		}
+		signal.notify_all();
+		worker.join();
+	};
+
+	try {
+		while (front_n) {
+			{
+				std::lock_guard<std::mutex> held(lock);
+				busy = true;
+			}
+			signal.notify_all();
+
+			size_t kept = process(front.data(), front_n);
+			written += back_n;
+
+			{
+				std::unique_lock<std::mutex> held(lock);
+				signal.wait(held, [&] { return !busy; });
+				if (error) { std::rethrow_exception(error); }
+			}
+			front.swap(back);
+			back_n = kept;
+			front_n = read_n;
+		}
+	} catch (...) {
+		stop();
+		throw;
+	}
+	stop();
+
+	write(out, back.data(), back_n);
+	return written + back_n;
+}
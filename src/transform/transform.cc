@@ -3,4 +3,9 @@
  */
 
 #include "vector.hh"
+#include "transform.hh"
+#include "stream.hh"
+#include "geometry.hh"
+#include "random.hh"
+#include "curve.hh"
 //#include "matrix.hh"
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "transform/transform.hh"
+#include "transform/hierarchy.hh"
+
+namespace transform
+{
+	typedef Transform<float>	Transformf;
+	typedef Transform<double>	Transformd;
+
+	typedef Hierarchy<float>	Hierarchyf;
+	typedef Hierarchy<double>	Hierarchyd;
+}
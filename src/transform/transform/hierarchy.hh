@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "transform.hh"
+
+namespace transform
+{
+	// A flat transform hierarchy.
+	// Nodes are stored in topologically sorted order (every parent precedes its children), with local
+	// transforms held as one array per component and world transforms as 3x4 row-major affine matrices.
+	// update() recomputes world matrices in a single linear pass, visiting only nodes that were changed
+	// since the last update, or that have a changed ancestor.
+	template <class T>
+	class Hierarchy
+	{
+	private:
+		std::vector<int> _parent;
+		std::vector<T> _tx, _ty, _tz;			// translation
+		std::vector<T> _qx, _qy, _qz, _qw;		// rotation
+		std::vector<T> _sx, _sy, _sz;			// scale
+		std::vector<unsigned char> _dirty;
+		std::vector<T> _world;					// 12 per node
+
+		std::vector<size_t> _ranges;			// start of each independent run of whole subtrees
+		bool _ranges_valid = false;
+
+		void update_ranges();
+		void update_range(const size_t begin, const size_t end);
+
+	public:
+		Hierarchy() = default;
+
+		// structure
+		size_t add(const int parent, const Transform<T>& local);	// parent < size(), or -1 for a root; throws std::out_of_range otherwise
+		size_t size() const { return _parent.size(); }
+		void reserve(const size_t n);
+		void clear();
+
+		// nodes
+		int parent(const size_t i) const { return _parent[i]; }
+		const Transform<T> local(const size_t i) const;
+		void set_local(const size_t i, const Transform<T>& local);
+		void set_translation(const size_t i, const Vector3<T>& t);
+		void set_rotation(const size_t i, const Vector4<T>& r);
+		void set_scale(const size_t i, const Vector3<T>& s);
+
+		const T* world(const size_t i) const { return &_world[i * 12]; }	// 3x4 row-major affine matrix
+		const Vector3<T> position(const size_t i) const;				// world-space translation
+
+		// propagation
+		void update();
+		void update(const unsigned threads);	// parallel across independent roots
+	};
+}
+
+using transform::Hierarchy;
+
+template <class T>
+size_t Hierarchy<T>::add(const int parent, const Transform<T>& local)
+{
+	// checked in every build, since a bad parent would silently break the parent-before-child order
+	if (parent < -1 || parent >= (int) size()) { throw std::out_of_range("transform::Hierarchy: parent out of range"); }
+
+	size_t i = size();
+	_parent.push_back(parent);
+	_tx.push_back(0); _ty.push_back(0); _tz.push_back(0);
+	_qx.push_back(0); _qy.push_back(0); _qz.push_back(0); _qw.push_back(1);
+	_sx.push_back(1); _sy.push_back(1); _sz.push_back(1);
+	_dirty.push_back(1);
+	_world.resize(_world.size() + 12);
+	_ranges_valid = false;
+
+	set_local(i, local);
+	return i;
+}
+
+template <class T>
+void Hierarchy<T>::reserve(const size_t n)
+{
+	_parent.reserve(n);
+	_tx.reserve(n); _ty.reserve(n); _tz.reserve(n);
+	_qx.reserve(n); _qy.reserve(n); _qz.reserve(n); _qw.reserve(n);
+	_sx.reserve(n); _sy.reserve(n); _sz.reserve(n);
+	_dirty.reserve(n);
+	_world.reserve(n * 12);
+}
+
+template <class T>
+void Hierarchy<T>::clear()
+{
+	_parent.clear();
+	_tx.clear(); _ty.clear(); _tz.clear();
+	_qx.clear(); _qy.clear(); _qz.clear(); _qw.clear();
+	_sx.clear(); _sy.clear(); _sz.clear();
+	_dirty.clear();
+	_world.clear();
+	_ranges_valid = false;
+}
+
+template <class T>
+const Transform<T> Hierarchy<T>::local(const size_t i) const
+{
+	return Transform<T>(
+		Vector3<T>(_tx[i], _ty[i], _tz[i]),
+		Vector4<T>(_qx[i], _qy[i], _qz[i], _qw[i]),
+		Vector3<T>(_sx[i], _sy[i], _sz[i])
+	);
+}
+
+template <class T>
+void Hierarchy<T>::set_local(const size_t i, const Transform<T>& local)
+{
+	set_translation(i, local.translation);
+	set_rotation(i, local.rotation);
+	set_scale(i, local.scale);
+}
+
+template <class T>
+void Hierarchy<T>::set_translation(const size_t i, const Vector3<T>& t)
+{
+	_tx[i] = t.x; _ty[i] = t.y; _tz[i] = t.z;
+	_dirty[i] = 1;
+}
+
+template <class T>
+void Hierarchy<T>::set_rotation(const size_t i, const Vector4<T>& r)
+{
+	_qx[i] = r.x; _qy[i] = r.y; _qz[i] = r.z; _qw[i] = r.w;
+	_dirty[i] = 1;
+}
+
+template <class T>
+void Hierarchy<T>::set_scale(const size_t i, const Vector3<T>& s)
+{
+	_sx[i] = s.x; _sy[i] = s.y; _sz[i] = s.z;
+	_dirty[i] = 1;
+}
+
+template <class T>
+const Vector3<T> Hierarchy<T>::position(const size_t i) const
+{
+	const T* m = world(i);
+	return Vector3<T>(m[3], m[7], m[11]);
+}
+
+// Splits the nodes into contiguous runs that no parent link crosses.
+// Each root starts a new run; a node whose parent lies in an earlier run merges every run since then.
+template <class T>
+void Hierarchy<T>::update_ranges()
+{
+	_ranges.clear();
+	for (size_t i = 0; i < size(); i++) {
+		int p = _parent[i];
+		if (p < 0 || _ranges.empty()) {
+			_ranges.push_back(i);
+			continue;
+		}
+		while (_ranges.size() > 1 && _ranges.back() > (size_t) p) { _ranges.pop_back(); }
+	}
+	_ranges_valid = true;
+}
+
+template <class T>
+void Hierarchy<T>::update_range(const size_t begin, const size_t end)
+{
+	using transform::math::fmadd;
+
+	for (size_t i = begin; i < end; i++) {
+		int p = _parent[i];
+		if (p >= 0 && _dirty[p]) { _dirty[i] = 1; }
+		if (!_dirty[i]) { continue; }
+
+		T l[12];
+		Transform<T>::matrix(
+			_tx[i], _ty[i], _tz[i],
+			_qx[i], _qy[i], _qz[i], _qw[i],
+			_sx[i], _sy[i], _sz[i],
+			l
+		);
+
+		T* m = &_world[i * 12];
+		if (p < 0) {
+			for (int k = 0; k < 12; k++) { m[k] = l[k]; }
+			continue;
+		}
+
+		const T* pm = &_world[(size_t) p * 12];
+		for (int r = 0; r < 3; r++) {
+			const T* pr = pm + r * 4;
+			for (int c = 0; c < 4; c++) {
+				T v = (c == 3) ? pr[3] : (T) 0;
+				v = fmadd(pr[0], l[c], v);
+				v = fmadd(pr[1], l[4 + c], v);
+				v = fmadd(pr[2], l[8 + c], v);
+				m[r * 4 + c] = v;
+			}
+		}
+	}
+
+	// children have consulted their parents' flags by now
+	for (size_t i = begin; i < end; i++) { _dirty[i] = 0; }
+}
+
+template <class T>
+void Hierarchy<T>::update()
+{
+	update_range(0, size());
+}
+
+// Independent runs are dealt out in contiguous groups of roughly equal node count. Groups with nothing dirty
+// are skipped, the calling thread takes the last one, and a single group runs without starting any thread.
+template <class T>
+void Hierarchy<T>::update(const unsigned threads)
+{
+	if (threads <= 1) {
+		update();
+		return;
+	}
+	if (!_ranges_valid) { update_ranges(); }
+
+	const size_t n = size();
+	const size_t share = (n + threads - 1) / threads;
+	std::vector<std::pair<size_t, size_t>> groups;
+
+	size_t r = 0;
+	while (r < _ranges.size()) {
+		size_t begin = _ranges[r];
+		size_t end = n;
+		while (++r < _ranges.size()) {
+			if (_ranges[r] - begin >= share) { end = _ranges[r]; break; }
+		}
+		// runs are whole subtrees, so a group with no dirty flag has nothing to recompute
+		if (std::find(_dirty.begin() + begin, _dirty.begin() + end, 1) != _dirty.begin() + end) {
+			groups.emplace_back(begin, end);
+		}
+	}
+	if (groups.empty()) { return; }
+
+	std::vector<std::thread> workers;
+	for (size_t g = 0; g + 1 < groups.size(); g++) {
+		workers.emplace_back(&Hierarchy<T>::update_range, this, groups[g].first, groups[g].second);
+	}
+	update_range(groups.back().first, groups.back().second);
+
+	for (std::thread& t : workers) { t.join(); }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+
+#include "../vector.hh"
+
+namespace transform
+{
+	// Translation, rotation, and scale, applied to a point as scale, then rotation, then translation.
+	template <class T>
+	class Transform
+	{
+	public:
+		Vector3<T> translation;
+		Vector4<T> rotation;	// unit quaternion, {x, y, z, w}
+		Vector3<T> scale;
+
+		Transform();														// identity construct
+		Transform(const Vector3<T>& t, const Vector4<T>& r, const Vector3<T>& s);	// member construct
+		Transform(const Transform<T>& t) = default;							// copy construct
+
+		Transform<T>& operator=(const Transform<T>&) = default;				// assignment
+
+		// utility
+		Transform<T>& identity();
+
+		// math
+		const Vector3<T> apply(const Vector3<T>& p) const;	// transform a point
+		void matrix(T m[12]) const;							// 3x4 row-major affine matrix
+
+		static void matrix(
+			const T tx, const T ty, const T tz,
+			const T qx, const T qy, const T qz, const T qw,
+			const T sx, const T sy, const T sz,
+			T m[12]
+		);													// from loose components
+	};
+}
+
+using transform::Transform;
+
+template <class T>
+Transform<T>::Transform()
+{
+	identity();
+}
+
+template <class T>
+Transform<T>::Transform(const Vector3<T>& t, const Vector4<T>& r, const Vector3<T>& s)
+	: translation(t), rotation(r), scale(s)
+{
+}
+
+template <class T>
+Transform<T>& Transform<T>::identity()
+{
+	translation.set(0, 0, 0);
+	rotation.set(0, 0, 0, 1);
+	scale.set(1, 1, 1);
+	return *this;
+}
+
+// Rotates with v' = v + w * t + u x t, where u is the vector part of the quaternion and t = 2 * (u x v).
+template <class T>
+inline const Vector3<T> Transform<T>::apply(const Vector3<T>& p) const
+{
+	Vector3<T> u = Vector3<T>(rotation.x, rotation.y, rotation.z);
+	Vector3<T> v = Vector3<T>(p * scale);
+	Vector3<T> t = Vector3<T>(u.cross(v) * (T) 2);
+	return Vector3<T>(transform::madd(t, rotation.w, v + u.cross(t)) + translation);
+}
+
+template <class T>
+void Transform<T>::matrix(T m[12]) const
+{
+	matrix(
+		translation.x, translation.y, translation.z,
+		rotation.x, rotation.y, rotation.z, rotation.w,
+		scale.x, scale.y, scale.z,
+		m
+	);
+}
+
+template <class T>
+void Transform<T>::matrix(
+	const T tx, const T ty, const T tz,
+	const T x, const T y, const T z, const T w,
+	const T sx, const T sy, const T sz,
+	T m[12]
+)
+{
+	const T xx = x * x, yy = y * y, zz = z * z;
+	const T xy = x * y, xz = x * z, yz = y * z;
+	const T wx = w * x, wy = w * y, wz = w * z;
+
+	m[0] = (1 - 2 * (yy + zz)) * sx;
+	m[1] = (2 * (xy - wz)) * sy;
+	m[2] = (2 * (xz + wy)) * sz;
+	m[3] = tx;
+
+	m[4] = (2 * (xy + wz)) * sx;
+	m[5] = (1 - 2 * (xx + zz)) * sy;
+	m[6] = (2 * (yz - wx)) * sz;
+	m[7] = ty;
+
+	m[8] = (2 * (xz - wy)) * sx;
+	m[9] = (2 * (yz + wx)) * sy;
+	m[10] = (1 - 2 * (xx + yy)) * sz;
+	m[11] = tz;
+}
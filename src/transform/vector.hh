@@ -1,25 +1,42 @@
 #pragma once
 
+#include "vector_fwd.hh"
+
 #include "vector/vector2.hh"
 #include "vector/vector3.hh"
 #include "vector/vector4.hh"
 
 #include "vector/vector.hh"
+#include "vector/hash.hh"
+
+// The int, float, and double vectors are instantiated once, in libtransform.a (see vector/vector.cc),
+// instead of in every translation unit that uses them. Define TRANSFORM_HEADER_ONLY to use the headers
+// without linking the library.
+#ifndef TRANSFORM_HEADER_ONLY
 namespace transform
 {
-	typedef Vector2<bool>		Vector2b;
-	typedef Vector2<int>		Vector2i;
-	typedef Vector2<float>		Vector2f;
-	typedef Vector2<double>		Vector2d;
+	extern template class Vector<2, int>;
+	extern template class Vector<2, float>;
+	extern template class Vector<2, double>;
+
+	extern template class Vector<3, int>;
+	extern template class Vector<3, float>;
+	extern template class Vector<3, double>;
+
+	extern template class Vector<4, int>;
+	extern template class Vector<4, float>;
+	extern template class Vector<4, double>;
 
-	typedef Vector3<bool>		Vector3b;
-	typedef Vector3<int>		Vector3i;
-	typedef Vector3<float>		Vector3f;
-	typedef Vector3<double>		Vector3d;
+	extern template class Vector2<int>;
+	extern template class Vector2<float>;
+	extern template class Vector2<double>;
 
-	typedef Vector4<bool>		Vector4b;
-	typedef Vector4<int>		Vector4i;
-	typedef Vector4<float>		Vector4f;
-	typedef Vector4<double>		Vector4d;
+	extern template class Vector3<int>;
+	extern template class Vector3<float>;
+	extern template class Vector3<double>;
 
+	extern template class Vector4<int>;
+	extern template class Vector4<float>;
+	extern template class Vector4<double>;
 }
+#endif
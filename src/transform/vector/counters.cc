@@ -0,0 +1,97 @@
+#include "counters.hh"
+
+#ifdef TRANSFORM_INSTRUMENT
+
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+
+using namespace transform::counters;
+
+namespace
+{
+	struct Registry
+	{
+		std::mutex lock;
+		std::vector<std::string> types;
+		std::vector<Table*> live;
+		unsigned long long retired[capacity * EVENTS] = {};
+	};
+
+	// Never destroyed, so threads exiting during static destruction can still fold their counts in.
+	Registry& registry()
+	{
+		static Registry* r = new Registry();
+		return *r;
+	}
+}
+
+Table::Table()
+{
+	for (auto& c : count) { c.store(0, std::memory_order_relaxed); }
+
+	Registry& r = registry();
+	std::lock_guard<std::mutex> guard(r.lock);
+	r.live.push_back(this);
+}
+
+Table::~Table()
+{
+	Registry& r = registry();
+	std::lock_guard<std::mutex> guard(r.lock);
+	for (size_t i = 0; i < capacity * EVENTS; i++) { r.retired[i] += count[i].load(std::memory_order_relaxed); }
+	r.live.erase(std::find(r.live.begin(), r.live.end(), this));
+}
+
+size_t transform::counters::enroll(const std::string& type)
+{
+	Registry& r = registry();
+	std::lock_guard<std::mutex> guard(r.lock);
+	r.types.push_back(type);
+	return std::min(r.types.size() - 1, capacity - 1);
+}
+
+std::vector<Entry> transform::counters::snapshot()
+{
+	Registry& r = registry();
+	std::lock_guard<std::mutex> guard(r.lock);
+
+	std::vector<Entry> entries(std::min(r.types.size(), capacity));
+	for (size_t i = 0; i < entries.size(); i++) {
+		entries[i].type = (i == capacity - 1 && r.types.size() > capacity) ? "(other)" : r.types[i];
+		for (int e = 0; e < EVENTS; e++) {
+			unsigned long long total = r.retired[i * EVENTS + e];
+			for (Table* t : r.live) { total += t->count[i * EVENTS + e].load(std::memory_order_relaxed); }
+			entries[i].count[e] = total;
+		}
+	}
+	return entries;
+}
+
+// Counts recorded by other threads while this runs may be lost.
+void transform::counters::reset()
+{
+	Registry& r = registry();
+	std::lock_guard<std::mutex> guard(r.lock);
+	for (auto& c : r.retired) { c = 0; }
+	for (Table* t : r.live) {
+		for (auto& c : t->count) { c.store(0, std::memory_order_relaxed); }
+	}
+}
+
+void transform::counters::dump(std::ostream& out)
+{
+	out << std::left << std::setw(24) << "type"
+		<< std::right << std::setw(16) << "constructions"
+		<< std::setw(16) << "copies"
+		<< std::setw(16) << "sqrts"
+		<< std::setw(16) << "divisions" << '\n';
+
+	for (const Entry& entry : snapshot()) {
+		out << std::left << std::setw(24) << entry.type << std::right;
+		for (int e = 0; e < EVENTS; e++) { out << std::setw(16) << entry.count[e]; }
+		out << '\n';
+	}
+}
+
+#endif
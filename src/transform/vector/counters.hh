@@ -0,0 +1,82 @@
+#pragma once
+
+/*
+ *	Per-instantiation operation counters for Vector<N, T>.
+ *	Only compiled in when TRANSFORM_INSTRUMENT is defined; otherwise TRANSFORM_COUNT expands to nothing.
+ */
+
+#ifdef TRANSFORM_INSTRUMENT
+
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace transform
+{
+	namespace counters
+	{
+		enum Event { CONSTRUCT, COPY, SQRT, DIVIDE, EVENTS };
+
+		// Maximum number of distinct Vector<N, T> instantiations tracked; any beyond share the last slot.
+		const size_t capacity = 64;
+
+		struct Entry
+		{
+			std::string type;
+			unsigned long long count[EVENTS];
+		};
+
+		// One per thread. Only the owning thread writes its counts, so increments need no locked
+		// instructions; the atomics only make concurrent snapshot() reads well-defined.
+		struct Table
+		{
+			std::atomic<unsigned long long> count[capacity * EVENTS];
+
+			Table();	// registers with the global registry
+			~Table();	// folds this thread's counts into the global totals
+		};
+
+		size_t enroll(const std::string& type);
+
+		std::vector<Entry> snapshot();		// totals across all threads, live and exited
+		void reset();
+		void dump(std::ostream& out);
+
+		template <class T> inline const char* type_name() { return typeid(T).name(); }
+		template <> inline const char* type_name<bool>() { return "bool"; }
+		template <> inline const char* type_name<int>() { return "int"; }
+		template <> inline const char* type_name<float>() { return "float"; }
+		template <> inline const char* type_name<double>() { return "double"; }
+
+		inline std::atomic<unsigned long long>* local()
+		{
+			thread_local Table table;
+			return table.count;
+		}
+
+		template <int N, class T>
+		inline size_t id()
+		{
+			static const size_t i = enroll("Vector<" + std::to_string(N) + ", " + type_name<T>() + ">");
+			return i;
+		}
+
+		template <int N, class T>
+		inline void record(const Event e, const unsigned long long n)
+		{
+			std::atomic<unsigned long long>& c = local()[id<N, T>() * EVENTS + e];
+			c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+		}
+	}
+}
+
+// Used inside Vector<N, T> members, where N and T are in scope.
+#define TRANSFORM_COUNT(event, n) transform::counters::record<N, T>(transform::counters::event, n)
+
+#else
+
+#define TRANSFORM_COUNT(event, n) ((void) 0)
+
+#endif
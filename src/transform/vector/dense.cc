@@ -0,0 +1,104 @@
+#include "dense.hh"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace transform::dense;
+
+namespace
+{
+	// a ranks before b
+	inline bool better(const Match& a, const Match& b)
+	{
+		return (a.score > b.score) || (a.score == b.score && a.index < b.index);
+	}
+
+	// a.b and b.b in one pass over b
+	inline float dot_length2(const float* a, const float* b, const size_t n, float& bb)
+	{
+		using namespace transform::simd;
+
+		floatv ab0 = zero(), ab1 = zero(), bb0 = zero(), bb1 = zero();
+		size_t i = 0;
+		for (; i + 2 * width <= n; i += 2 * width) {
+			floatv y0 = load(b + i), y1 = load(b + i + width);
+			ab0 = madd(load(a + i), y0, ab0);
+			ab1 = madd(load(a + i + width), y1, ab1);
+			bb0 = madd(y0, y0, bb0);
+			bb1 = madd(y1, y1, bb1);
+		}
+
+		float sab = hsum(add(ab0, ab1));
+		bb = hsum(add(bb0, bb1));
+		for (; i < n; i++) {
+			sab = transform::math::fmadd(a[i], b[i], sab);
+			bb = transform::math::fmadd(b[i], b[i], bb);
+		}
+		return sab;
+	}
+
+	// Keeps the k best of rows [begin, end) in heap, worst at the front.
+	void scan(
+		const float* query, const float qn, const float* rows, const size_t begin, const size_t end,
+		const size_t dim, const size_t k, const Metric metric, std::vector<Match>& heap
+	)
+	{
+		heap.reserve(k);
+		for (size_t r = begin; r < end; r++) {
+			const float* row = rows + r * dim;
+
+			float score;
+			if (metric == COSINE) {
+				float rr;
+				float qr = dot_length2(query, row, dim, rr);
+				float norm = qn * std::sqrt(rr);
+				score = norm ? qr / norm : 0.0f;
+			} else {
+				score = dot(query, row, dim);
+			}
+
+			Match m = { r, score };
+			if (heap.size() < k) {
+				heap.push_back(m);
+				std::push_heap(heap.begin(), heap.end(), better);
+			} else if (better(m, heap.front())) {
+				std::pop_heap(heap.begin(), heap.end(), better);
+				heap.back() = m;
+				std::push_heap(heap.begin(), heap.end(), better);
+			}
+		}
+	}
+}
+
+size_t transform::dense::topk(
+	const float* query, const float* rows, const size_t count, const size_t dim,
+	const size_t k, Match* out, const Metric metric, const unsigned threads
+)
+{
+	const size_t kk = std::min(k, count);
+	if (!kk) { return 0; }
+
+	const float qn = (metric == COSINE) ? std::sqrt(length2(query, dim)) : 1.0f;
+	const size_t workers = std::max<size_t>(1, std::min<size_t>(threads, count));
+	std::vector<std::vector<Match>> heaps(workers);
+
+	if (workers == 1) {
+		scan(query, qn, rows, 0, count, dim, kk, metric, heaps[0]);
+	} else {
+		std::vector<std::thread> pool;
+		const size_t share = (count + workers - 1) / workers;
+		for (size_t t = 0; t < workers; t++) {
+			size_t begin = std::min(count, t * share);
+			size_t end = std::min(count, begin + share);
+			pool.emplace_back(scan, query, qn, rows, begin, end, dim, kk, metric, std::ref(heaps[t]));
+		}
+		for (std::thread& t : pool) { t.join(); }
+	}
+
+	std::vector<Match> all;
+	for (std::vector<Match>& heap : heaps) { all.insert(all.end(), heap.begin(), heap.end()); }
+	std::partial_sort(all.begin(), all.begin() + kk, all.end(), better);
+	std::copy(all.begin(), all.begin() + kk, out);
+	return kk;
+}
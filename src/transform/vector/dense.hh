@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cmath>
+#include <memory>
+
+#include "../math/fma.hh"
+#include "../math/simd.hh"
+
+namespace transform
+{
+	template <int N, class T>
+	class Vector;
+
+	// Kernels for long float vectors, such as embeddings.
+	// Partial sums are kept in several independent SIMD accumulators, so the adds pipeline instead of
+	// waiting on one another; the order of summation therefore differs from a plain left-to-right loop.
+	namespace dense
+	{
+		// Vector<N, float> members switch to these kernels from this length on, unless the build is --no-fma,
+		// whose results stay bit-exact with the plain left-to-right loops.
+		const int threshold = 16;
+#if defined(TRANSFORM_NO_FMA)
+		const bool members = false;
+#else
+		const bool members = true;
+#endif
+
+		struct Match
+		{
+			size_t index;
+			float score;
+		};
+
+		enum Metric { DOT, COSINE };
+
+		float dot(const float* a, const float* b, const size_t n);
+		float length2(const float* a, const size_t n);
+		float cosine(const float* a, const float* b, const size_t n);
+
+		// Brute-force search of count rows of dim floats, stored back to back, for the k scoring highest
+		// against query. Writes them to out best first, ties going to the lower index, and returns how many
+		// were written (k, or count if smaller). Rows are split evenly across threads.
+		size_t topk(
+			const float* query, const float* rows, const size_t count, const size_t dim,
+			const size_t k, Match* out, const Metric metric = COSINE, const unsigned threads = 1
+		);
+
+		template <int N>
+		size_t topk(
+			const Vector<N, float>& query, const Vector<N, float>* rows, const size_t count,
+			const size_t k, Match* out, const Metric metric = COSINE, const unsigned threads = 1
+		);
+	}
+}
+
+inline float transform::dense::dot(const float* a, const float* b, const size_t n)
+{
+	using namespace transform::simd;
+
+	floatv acc0 = zero(), acc1 = zero(), acc2 = zero(), acc3 = zero();
+	size_t i = 0;
+	for (; i + 4 * width <= n; i += 4 * width) {
+		acc0 = madd(load(a + i), load(b + i), acc0);
+		acc1 = madd(load(a + i + width), load(b + i + width), acc1);
+		acc2 = madd(load(a + i + 2 * width), load(b + i + 2 * width), acc2);
+		acc3 = madd(load(a + i + 3 * width), load(b + i + 3 * width), acc3);
+	}
+	for (; i + width <= n; i += width) { acc0 = madd(load(a + i), load(b + i), acc0); }
+
+	float result = hsum(add(add(acc0, acc1), add(acc2, acc3)));
+	for (; i < n; i++) { result = transform::math::fmadd(a[i], b[i], result); }
+	return result;
+}
+
+inline float transform::dense::length2(const float* a, const size_t n)
+{
+	return dot(a, a, n);
+}
+
+// Accumulates a.b, a.a, and b.b in the same pass.
+inline float transform::dense::cosine(const float* a, const float* b, const size_t n)
+{
+	using namespace transform::simd;
+
+	floatv ab = zero(), aa = zero(), bb = zero();
+	const size_t body = n - n % width;
+	size_t i = 0;
+	for (; i < body; i += width) {
+		floatv x = load(a + i), y = load(b + i);
+		ab = madd(x, y, ab);
+		aa = madd(x, x, aa);
+		bb = madd(y, y, bb);
+	}
+
+	float sab = hsum(ab), saa = hsum(aa), sbb = hsum(bb);
+	for (; i < n; i++) {
+		sab = transform::math::fmadd(a[i], b[i], sab);
+		saa = transform::math::fmadd(a[i], a[i], saa);
+		sbb = transform::math::fmadd(b[i], b[i], sbb);
+	}
+
+	float norm = std::sqrt(saa * sbb);
+	return norm ? sab / norm : 0.0f;
+}
+
+template <int N>
+size_t transform::dense::topk(
+	const Vector<N, float>& query, const Vector<N, float>* rows, const size_t count,
+	const size_t k, Match* out, const Metric metric, const unsigned threads
+)
+{
+	static_assert(sizeof(Vector<N, float>) == N * sizeof(float), "rows must be packed");
+	return topk(query.ptr(), rows->ptr(), count, N, k, out, metric, threads);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include "vector.hh"
+
+namespace transform
+{
+	// Folds a 64-bit word into a running hash: one multiply and xor-shift per word.
+	inline uint64_t mix(uint64_t h, const uint64_t w)
+	{
+		h = (h ^ w) * 0x9E3779B97F4A7C15ull;
+		return h ^ (h >> 29);
+	}
+
+	// Hash of the exact element values, consistent with operator==: 0 and -0 hash alike.
+	// Use Vector::equals, or quantize first (see geometry/weld.hh), to find near matches.
+	template <int N, class T>
+	size_t hash(const Vector<N, T>& v);
+}
+
+template <int N, class T>
+inline size_t transform::hash(const Vector<N, T>& v)
+{
+	static_assert(sizeof(T) <= sizeof(uint64_t), "elements must fit in a 64-bit word");
+
+	uint64_t h = N;
+	for (int i = 0; i < N; i++) {
+		T x = v[i] + T(0);	// -0 + 0 is 0
+		uint64_t w = 0;
+		std::memcpy(&w, &x, sizeof(T));
+		h = transform::mix(h, w);
+	}
+	return (size_t) h;
+}
+
+namespace std
+{
+	template <int N, class T>
+	struct hash<transform::Vector<N, T>>
+	{
+		size_t operator()(const transform::Vector<N, T>& v) const { return transform::hash(v); }
+	};
+
+	template <class T>
+	struct hash<transform::Vector2<T>> : hash<transform::Vector<2, T>> {};
+
+	template <class T>
+	struct hash<transform::Vector3<T>> : hash<transform::Vector<3, T>> {};
+
+	template <class T>
+	struct hash<transform::Vector4<T>> : hash<transform::Vector<4, T>> {};
+}
@@ -0,0 +1,36 @@
+/*
+ *	Explicit instantiations of the common vector types, declared extern in vector.hh.
+ *	Vector<N, bool> is left out: boolean vectors only hold comparison results, and most of the
+ *	arithmetic members do not compile for bool.
+ */
+
+#include "../vector.hh"
+
+#ifndef TRANSFORM_HEADER_ONLY
+namespace transform
+{
+	template class Vector<2, int>;
+	template class Vector<2, float>;
+	template class Vector<2, double>;
+
+	template class Vector<3, int>;
+	template class Vector<3, float>;
+	template class Vector<3, double>;
+
+	template class Vector<4, int>;
+	template class Vector<4, float>;
+	template class Vector<4, double>;
+
+	template class Vector2<int>;
+	template class Vector2<float>;
+	template class Vector2<double>;
+
+	template class Vector3<int>;
+	template class Vector3<float>;
+	template class Vector3<double>;
+
+	template class Vector4<int>;
+	template class Vector4<float>;
+	template class Vector4<double>;
+}
+#endif
@@ -2,8 +2,26 @@
 
 #include <memory>
 
+#include "../math/fma.hh"
+#include "counters.hh"
+#include "dense.hh"
+
 namespace transform
 {
+	// swizzle indices, ZERO and ONE select constants instead of a component; kept out of transform itself so
+	// that single letter names do not leak into code that uses the library
+	namespace swizzle
+	{
+		enum Component { X = 0, Y = 1, Z = 2, W = 3, ZERO = -1, ONE = -2 };
+	}
+
+	template <int N, class T>
+	class Vector;
+
+	// the most specific class for an N element vector, specialized by Vector2, Vector3, and Vector4
+	template <int N, class T>
+	struct vector_type { typedef Vector<N, T> type; };
+
 	// typename std::enable_if<std::is_arithmetic<T>::value>
 	template <int N, class T>
 	class Vector
@@ -12,13 +30,21 @@ namespace transform
 		T _v[N];
 
 	public:
+		typedef T value_type;
+		static const int dimensions = N;
+
 		// constructors
+#ifdef TRANSFORM_INSTRUMENT
+		Vector() : _v() { TRANSFORM_COUNT(CONSTRUCT, 1); }	// default construct, counted
+#else
 		Vector() = default;				// default construct
+#endif
 		Vector(const Vector<N, T>& v);	// copy construct
 
 		// utility
 		Vector<N, T>& zero();
 		Vector<N, T>& normalize();
+		Vector<N, T>& madd(const Vector<N, T>&, const T);	// this += v * s, fused where supported
 
 		// math
 		const T mag() const;
@@ -26,9 +52,15 @@ namespace transform
 		const T length2() const;
 		const T sum() const;
 		const T dot(const Vector<N, T>&) const;
+		const T cosine(const Vector<N, T>&) const;			// cosine of the angle between, 0 if either is zero
 		const Vector<N, T> project(const Vector<N, T>&) const;
 		const Vector<N, T> reject(const Vector<N, T>&) const;
 		const Vector<N, T> abs() const;
+		const Vector<N, T> lerp(const Vector<N, T>&, const T) const;
+
+		// swizzle, e.g. swizzle<swizzle::X, swizzle::Z, swizzle::Y>() or with swizzle::ZERO or swizzle::ONE
+		template <int... I>
+		const typename vector_type<sizeof...(I), T>::type swizzle() const;
 
 		// operators
 		Vector<N, T>& operator=(const Vector<N, T>&);		// assignment
@@ -52,10 +84,12 @@ namespace transform
 		const Vector<N, T> operator<(const Vector<N, T>&);	// element-wise comparison, return vector of 1s and 0s
 		const Vector<N, T> operator>(const Vector<N, T>&);
 
-		bool operator==(const Vector<N, T>&);				// equality
-		bool operator!=(const Vector<N, T>&);				// inequality
+		bool operator==(const Vector<N, T>&) const;			// equality
+		bool operator!=(const Vector<N, T>&) const;			// inequality
+		bool equals(const Vector<N, T>&, const T) const;	// equality, each element within epsilon
 
 		T* ptr() { return _v; }
+		const T* ptr() const { return _v; }
 	};
 
 	template <int N, class T>
@@ -71,28 +105,56 @@ namespace transform
 	Vector<N, T> operator*(Vector<N, T>, const Vector<N, T>&);	// element-wise multiplication
 	template <int N, class T>
 	Vector<N, T> operator/(Vector<N, T>, const Vector<N, T>&);	// element-wise division
+
+	template <int N, class T>
+	Vector<N, T> fma(Vector<N, T>, const Vector<N, T>&, const Vector<N, T>&);	// element-wise a * b + c
+	template <int N, class T>
+	Vector<N, T> madd(Vector<N, T>, const T, const Vector<N, T>&);	// v * s + add
+	template <int N, class T>
+	Vector<N, T> lerp(Vector<N, T>, const Vector<N, T>&, const T);	// a + (b - a) * t
+	template <int N, class T>
+	Vector<N, T>& axpy(const T, const Vector<N, T>&, Vector<N, T>&);	// y += a * x
+
+	// batched variants over n contiguous vectors, V being Vector<N, T> or one of its subclasses
+	template <class V>
+	void fma(const V*, const V*, const V*, V*, const size_t);
+	template <class V>
+	void madd(const V*, const typename V::value_type, const V*, V*, const size_t);
+	template <class V>
+	void lerp(const V*, const V*, const typename V::value_type, V*, const size_t);
+	template <class V>
+	void axpy(const typename V::value_type, const V*, V*, const size_t);
 }
 
 using transform::Vector;
 
 template <int N, class T>
-Vector<N, T>::Vector(const Vector<N, T>& v)
+inline Vector<N, T>::Vector(const Vector<N, T>& v)
 {
+	TRANSFORM_COUNT(COPY, 1);
 	for (int i = 0; i < N; i++) { _v[i] = v[i]; }
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::zero()
+inline Vector<N, T>& Vector<N, T>::zero()
 {
 	for (int i = 0; i < N; i++) { _v[i] = 0.0; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::normalize()
+inline Vector<N, T>& Vector<N, T>::madd(const Vector<N, T>& v, const T s)
+{
+	for (int i = 0; i < N; i++) { _v[i] = transform::math::fmadd(v[i], s, _v[i]); }
+	return *this;
+}
+
+template <int N, class T>
+inline Vector<N, T>& Vector<N, T>::normalize()
 {
 	T n = mag();
 	if (n) {
+		TRANSFORM_COUNT(DIVIDE, N);
 		for (int i = 0; i < N; i++) { _v[i] /= n; }
 	}
 	return *this;
@@ -103,6 +165,7 @@ Vector<N, T>& Vector<N, T>::normalize()
 template <int N, class T>
 inline const T Vector<N, T>::mag() const
 {
+	TRANSFORM_COUNT(SQRT, 1);
 	return (T) sqrt(dot(*this));
 }
 
@@ -110,6 +173,7 @@ inline const T Vector<N, T>::mag() const
 template <int N, class T>
 inline const T Vector<N, T>::length() const
 {
+	TRANSFORM_COUNT(SQRT, 1);
 	return (T) sqrt(dot(*this));
 }
 
@@ -131,21 +195,77 @@ inline const T Vector<N, T>::sum() const
 template <int N, class T>
 inline const T Vector<N, T>::dot(const Vector<N, T>& v) const
 {
-	T result = 0.0;
-	for (int i = 0; i < N; i++) { result += _v[i] * v[i]; }
-	return result;
+	if constexpr (std::is_same<T, float>::value && N >= transform::dense::threshold && transform::dense::members) {
+		return transform::dense::dot(_v, v._v, N);
+	} else {
+		T result = 0.0;
+		for (int i = 0; i < N; i++) { result = transform::math::fmadd(_v[i], v[i], result); }
+		return result;
+	}
+}
+
+template <int N, class T>
+inline const T Vector<N, T>::cosine(const Vector<N, T>& v) const
+{
+	TRANSFORM_COUNT(SQRT, 1);
+	TRANSFORM_COUNT(DIVIDE, 1);
+	if constexpr (std::is_same<T, float>::value && N >= transform::dense::threshold && transform::dense::members) {
+		return transform::dense::cosine(_v, v._v, N);
+	} else {
+		T norm = (T) sqrt(length2() * v.length2());
+		return norm ? dot(v) / norm : (T) 0;
+	}
 }
 
 template <int N, class T>
 inline const Vector<N, T> Vector<N, T>::project(const Vector<N, T>& v) const
 {
+	TRANSFORM_COUNT(DIVIDE, 1);
 	return (v * (this->dot(v) / v.dot(v)));
 }
 
 template <int N, class T>
 inline const Vector<N, T> Vector<N, T>::reject(const Vector<N, T>& v) const
 {
-	return (*this - this->project(v));
+	// this - v * s, with the subtraction fused into the scale
+	TRANSFORM_COUNT(DIVIDE, 1);
+	T s = this->dot(v) / v.dot(v);
+	Vector<N, T> result = *this;
+	for (int i = 0; i < N; i++) { result[i] = transform::math::fmadd(-v[i], s, _v[i]); }
+	return result;
+}
+
+// Computed as (this - this * t) + v * t, which is exact at both t = 0 and t = 1.
+template <int N, class T>
+inline const Vector<N, T> Vector<N, T>::lerp(const Vector<N, T>& v, const T t) const
+{
+	Vector<N, T> result = *this;
+	for (int i = 0; i < N; i++) {
+		result[i] = transform::math::fmadd(t, v[i], transform::math::fmadd(-t, _v[i], _v[i]));
+	}
+	return result;
+}
+
+// Indices are fixed at compile time, so this reduces to one move per element.
+template <int N, class T>
+template <int... I>
+inline const typename transform::vector_type<sizeof...(I), T>::type Vector<N, T>::swizzle() const
+{
+	static_assert(((I >= transform::swizzle::ONE && I < N) && ...), "swizzle index out of range");
+
+	typename transform::vector_type<sizeof...(I), T>::type result;
+	T* r = result.ptr();
+	int k = 0;
+	((r[k++] = (I == transform::swizzle::ZERO) ? (T) 0 : (I == transform::swizzle::ONE) ? (T) 1 : _v[I < 0 ? 0 : I]), ...);
+	return result;
+}
+
+template <int N, class T>
+inline Vector<N, T>& Vector<N, T>::operator=(const Vector<N, T>& v)
+{
+	TRANSFORM_COUNT(COPY, 1);
+	for (int i = 0; i < N; i++) { _v[i] = v[i]; }
+	return *this;
 }
 
 template <int N, class T>
@@ -155,7 +275,7 @@ inline const T Vector<N, T>::operator[](const size_t i) const
 }
 
 template <int N, class T>
-T& Vector<N, T>::operator[](const size_t i)
+inline T& Vector<N, T>::operator[](const size_t i)
 {
 	return _v[i%N];
 }
@@ -169,43 +289,45 @@ inline const Vector<N, T> Vector<N, T>::operator-()
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator*=(const T s)
+inline Vector<N, T>& Vector<N, T>::operator*=(const T s)
 {
 	for (int i = 0; i < N; i++) { _v[i] *= s; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator/=(const T s)
+inline Vector<N, T>& Vector<N, T>::operator/=(const T s)
 {
+	TRANSFORM_COUNT(DIVIDE, N);
 	for (int i = 0; i < N; i++) { _v[i] /= s; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator+=(const Vector<N, T>& v)
+inline Vector<N, T>& Vector<N, T>::operator+=(const Vector<N, T>& v)
 {
 	for (int i = 0; i < N; i++) { _v[i] += v[i]; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator-=(const Vector<N, T>& v)
+inline Vector<N, T>& Vector<N, T>::operator-=(const Vector<N, T>& v)
 {
 	for (int i = 0; i < N; i++) { _v[i] -= v[i]; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator*=(const Vector<N, T>& v)
+inline Vector<N, T>& Vector<N, T>::operator*=(const Vector<N, T>& v)
 {
 	for (int i = 0; i < N; i++) { _v[i] *= v[i]; }
 	return *this;
 }
 
 template <int N, class T>
-Vector<N, T>& Vector<N, T>::operator/=(const Vector<N, T>& v)
+inline Vector<N, T>& Vector<N, T>::operator/=(const Vector<N, T>& v)
 {
+	TRANSFORM_COUNT(DIVIDE, N);
 	for (int i = 0; i < N; i++) { _v[i] /= v[i]; }
 	return *this;
 }
@@ -239,16 +361,25 @@ inline const Vector<N, T> Vector<N, T>::operator>(const Vector<N, T>& v) {
 }
 
 template <int N, class T>
-inline bool Vector<N, T>::operator==(const Vector<N, T>& v) {
+inline bool Vector<N, T>::operator==(const Vector<N, T>& v) const {
 	for (int i = 0; i < N; i++) { if (_v[i] != v[i]) { return false; } }
 	return true;
 }
 
 template <int N, class T>
-inline bool Vector<N, T>::operator!=(const Vector<N, T>& v) {
+inline bool Vector<N, T>::operator!=(const Vector<N, T>& v) const {
 	return !(*this == v);
 }
 
+template <int N, class T>
+inline bool Vector<N, T>::equals(const Vector<N, T>& v, const T epsilon) const {
+	for (int i = 0; i < N; i++) {
+		T d = (_v[i] > v[i]) ? _v[i] - v[i] : v[i] - _v[i];
+		if (!(d <= epsilon)) { return false; }
+	}
+	return true;
+}
+
 template <int N, class T>
 inline Vector<N, T> transform::operator*(Vector<N, T> v, const T s)
 {
@@ -290,3 +421,53 @@ inline Vector<N, T> transform::operator/(Vector<N, T> v1, const Vector<N, T>& v2
 	v1 /= v2;
 	return v1;
 }
+
+template <int N, class T>
+inline Vector<N, T> transform::fma(Vector<N, T> a, const Vector<N, T>& b, const Vector<N, T>& c)
+{
+	for (int i = 0; i < N; i++) { a[i] = transform::math::fmadd(a[i], b[i], c[i]); }
+	return a;
+}
+
+template <int N, class T>
+inline Vector<N, T> transform::madd(Vector<N, T> v, const T s, const Vector<N, T>& add)
+{
+	for (int i = 0; i < N; i++) { v[i] = transform::math::fmadd(v[i], s, add[i]); }
+	return v;
+}
+
+template <int N, class T>
+inline Vector<N, T> transform::lerp(Vector<N, T> a, const Vector<N, T>& b, const T t)
+{
+	return a.lerp(b, t);
+}
+
+template <int N, class T>
+inline Vector<N, T>& transform::axpy(const T a, const Vector<N, T>& x, Vector<N, T>& y)
+{
+	return y.madd(x, a);
+}
+
+template <class V>
+void transform::fma(const V* a, const V* b, const V* c, V* out, const size_t n)
+{
+	for (size_t i = 0; i < n; i++) { out[i] = transform::fma(a[i], b[i], c[i]); }
+}
+
+template <class V>
+void transform::madd(const V* v, const typename V::value_type s, const V* add, V* out, const size_t n)
+{
+	for (size_t i = 0; i < n; i++) { out[i] = transform::madd(v[i], s, add[i]); }
+}
+
+template <class V>
+void transform::lerp(const V* a, const V* b, const typename V::value_type t, V* out, const size_t n)
+{
+	for (size_t i = 0; i < n; i++) { out[i] = a[i].lerp(b[i], t); }
+}
+
+template <class V>
+void transform::axpy(const typename V::value_type a, const V* x, V* y, const size_t n)
+{
+	for (size_t i = 0; i < n; i++) { y[i].madd(x[i], a); }
+}
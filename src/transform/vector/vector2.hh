@@ -6,6 +6,9 @@
 
 namespace transform
 {
+	template <class T>
+	class Vector3;
+
 	template <class T>
 	class Vector2 : public Vector<2, T>
 	{
@@ -32,6 +35,9 @@ namespace transform
 			this->_v[1] = v[1];
 		}
 
+		Vector2<T>& operator=(const Vector2<T>& v) { super::operator=(v); return *this; }		// assignment
+		Vector2<T>& operator=(const Vector<2, T>& v) { super::operator=(v); return *this; }	// assignment from superclass
+
 		// members
 		T& x = this->_v[0];
 		T& y = this->_v[1];
@@ -44,20 +50,30 @@ namespace transform
 
 		// math
 		const T cross(const Vector2<T>&) const;
+
+		// swizzles
+		typedef transform::swizzle::Component Component;
+		const Vector2<T> xy() const { return this->template swizzle<Component::X, Component::Y>(); }
+		const Vector2<T> yx() const { return this->template swizzle<Component::Y, Component::X>(); }
+		const Vector3<T> xy0() const { return this->template swizzle<Component::X, Component::Y, Component::ZERO>(); }
+		const Vector3<T> xy1() const { return this->template swizzle<Component::X, Component::Y, Component::ONE>(); }
 	};
+
+	template <class T>
+	struct vector_type<2, T> { typedef Vector2<T> type; };
 }
 
 using transform::Vector2;
 
 template <class T>
-Vector2<T>::Vector2(T x, T y)
+inline Vector2<T>::Vector2(T x, T y)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
 }
 
 template <class T>
-Vector2<T>& Vector2<T>::set(const T x, const T y)
+inline Vector2<T>& Vector2<T>::set(const T x, const T y)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
@@ -69,5 +85,5 @@ Vector2<T>& Vector2<T>::set(const T x, const T y)
 template <class T>
 inline const T Vector2<T>::cross(const Vector2<T>& v) const
 {
-	return x * v.y - y * v.x;
+	return transform::math::fmadd(x, v.y, -(y * v.x));
 }
@@ -6,6 +6,12 @@
 
 namespace transform
 {
+	template <class T>
+	class Vector2;
+
+	template <class T>
+	class Vector4;
+
 	template <class T>
 	class Vector3 : public Vector<3, T>
 	{
@@ -34,6 +40,9 @@ namespace transform
 			this->_v[2] = v[2];
 		}
 
+		Vector3<T>& operator=(const Vector3<T>& v) { super::operator=(v); return *this; }		// assignment
+		Vector3<T>& operator=(const Vector<3, T>& v) { super::operator=(v); return *this; }	// assignment from superclass
+
 		// members
 		T& x = this->_v[0];
 		T& y = this->_v[1];
@@ -48,13 +57,33 @@ namespace transform
 
 		// math
 		const Vector3<T> cross(const Vector3<T>& v) const;
+
+		// swizzles
+		typedef transform::swizzle::Component Component;
+		const Vector2<T> xy() const { return this->template swizzle<Component::X, Component::Y>(); }
+		const Vector2<T> xz() const { return this->template swizzle<Component::X, Component::Z>(); }
+		const Vector2<T> yx() const { return this->template swizzle<Component::Y, Component::X>(); }
+		const Vector2<T> yz() const { return this->template swizzle<Component::Y, Component::Z>(); }
+		const Vector2<T> zx() const { return this->template swizzle<Component::Z, Component::X>(); }
+		const Vector2<T> zy() const { return this->template swizzle<Component::Z, Component::Y>(); }
+		const Vector3<T> xyz() const { return this->template swizzle<Component::X, Component::Y, Component::Z>(); }
+		const Vector3<T> xzy() const { return this->template swizzle<Component::X, Component::Z, Component::Y>(); }
+		const Vector3<T> yxz() const { return this->template swizzle<Component::Y, Component::X, Component::Z>(); }
+		const Vector3<T> yzx() const { return this->template swizzle<Component::Y, Component::Z, Component::X>(); }
+		const Vector3<T> zxy() const { return this->template swizzle<Component::Z, Component::X, Component::Y>(); }
+		const Vector3<T> zyx() const { return this->template swizzle<Component::Z, Component::Y, Component::X>(); }
+		const Vector4<T> xyz0() const { return this->template swizzle<Component::X, Component::Y, Component::Z, Component::ZERO>(); }
+		const Vector4<T> xyz1() const { return this->template swizzle<Component::X, Component::Y, Component::Z, Component::ONE>(); }
 	};
+
+	template <class T>
+	struct vector_type<3, T> { typedef Vector3<T> type; };
 }
 
 using transform::Vector3;
 
 template <class T>
-Vector3<T>::Vector3(T x, T y, T z)
+inline Vector3<T>::Vector3(T x, T y, T z)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
@@ -62,7 +91,7 @@ Vector3<T>::Vector3(T x, T y, T z)
 }
 
 template <class T>
-Vector3<T>& Vector3<T>::set(const T x, const T y, const T z)
+inline Vector3<T>& Vector3<T>::set(const T x, const T y, const T z)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
@@ -73,5 +102,9 @@ Vector3<T>& Vector3<T>::set(const T x, const T y, const T z)
 template <class T>
 inline const Vector3<T> Vector3<T>::cross(const Vector3<T>& v) const
 {
-	return Vector3<T>(y * v.z - z * v.y, z * v.x - x * v.z, x * v.y - y * v.x);
+	return Vector3<T>(
+		transform::math::fmadd(y, v.z, -(z * v.y)),
+		transform::math::fmadd(z, v.x, -(x * v.z)),
+		transform::math::fmadd(x, v.y, -(y * v.x))
+	);
 }
@@ -6,6 +6,12 @@
 
 namespace transform
 {
+	template <class T>
+	class Vector2;
+
+	template <class T>
+	class Vector3;
+
 	template <class T>
 	class Vector4 : public Vector<4, T>
 	{
@@ -36,6 +42,9 @@ namespace transform
 			this->_v[3] = v[3];
 		}
 
+		Vector4<T>& operator=(const Vector4<T>& v) { super::operator=(v); return *this; }		// assignment
+		Vector4<T>& operator=(const Vector<4, T>& v) { super::operator=(v); return *this; }	// assignment from superclass
+
 		// members
 		T& x = this->_v[0];
 		T& y = this->_v[1];
@@ -49,13 +58,79 @@ namespace transform
 
 		// utility
 		Vector4<T>& set(const T x, const T y, const T z, const T w);
+
+		// swizzles
+		typedef transform::swizzle::Component Component;
+		const Vector2<T> xy() const { return this->template swizzle<Component::X, Component::Y>(); }
+		const Vector2<T> xz() const { return this->template swizzle<Component::X, Component::Z>(); }
+		const Vector2<T> xw() const { return this->template swizzle<Component::X, Component::W>(); }
+		const Vector2<T> yx() const { return this->template swizzle<Component::Y, Component::X>(); }
+		const Vector2<T> yz() const { return this->template swizzle<Component::Y, Component::Z>(); }
+		const Vector2<T> yw() const { return this->template swizzle<Component::Y, Component::W>(); }
+		const Vector2<T> zx() const { return this->template swizzle<Component::Z, Component::X>(); }
+		const Vector2<T> zy() const { return this->template swizzle<Component::Z, Component::Y>(); }
+		const Vector2<T> zw() const { return this->template swizzle<Component::Z, Component::W>(); }
+		const Vector2<T> wx() const { return this->template swizzle<Component::W, Component::X>(); }
+		const Vector2<T> wy() const { return this->template swizzle<Component::W, Component::Y>(); }
+		const Vector2<T> wz() const { return this->template swizzle<Component::W, Component::Z>(); }
+		const Vector3<T> xyz() const { return this->template swizzle<Component::X, Component::Y, Component::Z>(); }
+		const Vector3<T> xyw() const { return this->template swizzle<Component::X, Component::Y, Component::W>(); }
+		const Vector3<T> xzy() const { return this->template swizzle<Component::X, Component::Z, Component::Y>(); }
+		const Vector3<T> xzw() const { return this->template swizzle<Component::X, Component::Z, Component::W>(); }
+		const Vector3<T> xwy() const { return this->template swizzle<Component::X, Component::W, Component::Y>(); }
+		const Vector3<T> xwz() const { return this->template swizzle<Component::X, Component::W, Component::Z>(); }
+		const Vector3<T> yxz() const { return this->template swizzle<Component::Y, Component::X, Component::Z>(); }
+		const Vector3<T> yxw() const { return this->template swizzle<Component::Y, Component::X, Component::W>(); }
+		const Vector3<T> yzx() const { return this->template swizzle<Component::Y, Component::Z, Component::X>(); }
+		const Vector3<T> yzw() const { return this->template swizzle<Component::Y, Component::Z, Component::W>(); }
+		const Vector3<T> ywx() const { return this->template swizzle<Component::Y, Component::W, Component::X>(); }
+		const Vector3<T> ywz() const { return this->template swizzle<Component::Y, Component::W, Component::Z>(); }
+		const Vector3<T> zxy() const { return this->template swizzle<Component::Z, Component::X, Component::Y>(); }
+		const Vector3<T> zxw() const { return this->template swizzle<Component::Z, Component::X, Component::W>(); }
+		const Vector3<T> zyx() const { return this->template swizzle<Component::Z, Component::Y, Component::X>(); }
+		const Vector3<T> zyw() const { return this->template swizzle<Component::Z, Component::Y, Component::W>(); }
+		const Vector3<T> zwx() const { return this->template swizzle<Component::Z, Component::W, Component::X>(); }
+		const Vector3<T> zwy() const { return this->template swizzle<Component::Z, Component::W, Component::Y>(); }
+		const Vector3<T> wxy() const { return this->template swizzle<Component::W, Component::X, Component::Y>(); }
+		const Vector3<T> wxz() const { return this->template swizzle<Component::W, Component::X, Component::Z>(); }
+		const Vector3<T> wyx() const { return this->template swizzle<Component::W, Component::Y, Component::X>(); }
+		const Vector3<T> wyz() const { return this->template swizzle<Component::W, Component::Y, Component::Z>(); }
+		const Vector3<T> wzx() const { return this->template swizzle<Component::W, Component::Z, Component::X>(); }
+		const Vector3<T> wzy() const { return this->template swizzle<Component::W, Component::Z, Component::Y>(); }
+		const Vector4<T> xyzw() const { return this->template swizzle<Component::X, Component::Y, Component::Z, Component::W>(); }
+		const Vector4<T> xywz() const { return this->template swizzle<Component::X, Component::Y, Component::W, Component::Z>(); }
+		const Vector4<T> xzyw() const { return this->template swizzle<Component::X, Component::Z, Component::Y, Component::W>(); }
+		const Vector4<T> xzwy() const { return this->template swizzle<Component::X, Component::Z, Component::W, Component::Y>(); }
+		const Vector4<T> xwyz() const { return this->template swizzle<Component::X, Component::W, Component::Y, Component::Z>(); }
+		const Vector4<T> xwzy() const { return this->template swizzle<Component::X, Component::W, Component::Z, Component::Y>(); }
+		const Vector4<T> yxzw() const { return this->template swizzle<Component::Y, Component::X, Component::Z, Component::W>(); }
+		const Vector4<T> yxwz() const { return this->template swizzle<Component::Y, Component::X, Component::W, Component::Z>(); }
+		const Vector4<T> yzxw() const { return this->template swizzle<Component::Y, Component::Z, Component::X, Component::W>(); }
+		const Vector4<T> yzwx() const { return this->template swizzle<Component::Y, Component::Z, Component::W, Component::X>(); }
+		const Vector4<T> ywxz() const { return this->template swizzle<Component::Y, Component::W, Component::X, Component::Z>(); }
+		const Vector4<T> ywzx() const { return this->template swizzle<Component::Y, Component::W, Component::Z, Component::X>(); }
+		const Vector4<T> zxyw() const { return this->template swizzle<Component::Z, Component::X, Component::Y, Component::W>(); }
+		const Vector4<T> zxwy() const { return this->template swizzle<Component::Z, Component::X, Component::W, Component::Y>(); }
+		const Vector4<T> zyxw() const { return this->template swizzle<Component::Z, Component::Y, Component::X, Component::W>(); }
+		const Vector4<T> zywx() const { return this->template swizzle<Component::Z, Component::Y, Component::W, Component::X>(); }
+		const Vector4<T> zwxy() const { return this->template swizzle<Component::Z, Component::W, Component::X, Component::Y>(); }
+		const Vector4<T> zwyx() const { return this->template swizzle<Component::Z, Component::W, Component::Y, Component::X>(); }
+		const Vector4<T> wxyz() const { return this->template swizzle<Component::W, Component::X, Component::Y, Component::Z>(); }
+		const Vector4<T> wxzy() const { return this->template swizzle<Component::W, Component::X, Component::Z, Component::Y>(); }
+		const Vector4<T> wyxz() const { return this->template swizzle<Component::W, Component::Y, Component::X, Component::Z>(); }
+		const Vector4<T> wyzx() const { return this->template swizzle<Component::W, Component::Y, Component::Z, Component::X>(); }
+		const Vector4<T> wzxy() const { return this->template swizzle<Component::W, Component::Z, Component::X, Component::Y>(); }
+		const Vector4<T> wzyx() const { return this->template swizzle<Component::W, Component::Z, Component::Y, Component::X>(); }
 	};
+
+	template <class T>
+	struct vector_type<4, T> { typedef Vector4<T> type; };
 }
 
 using transform::Vector4;
 
 template <class T>
-Vector4<T>::Vector4(T x, T y, T z, T w)
+inline Vector4<T>::Vector4(T x, T y, T z, T w)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
@@ -64,7 +139,7 @@ Vector4<T>::Vector4(T x, T y, T z, T w)
 }
 
 template <class T>
-Vector4<T>& Vector4<T>::set(const T x, const T y, const T z, const T w)
+inline Vector4<T>& Vector4<T>::set(const T x, const T y, const T z, const T w)
 {
 	this->_v[0] = x;
 	this->_v[1] = y;
@@ -0,0 +1,35 @@
+#pragma once
+
+/*
+ *	Forward declarations of the vector types, for headers that only pass them around by reference or pointer.
+ */
+
+namespace transform
+{
+	template <int N, class T>
+	class Vector;
+
+	template <class T>
+	class Vector2;
+
+	template <class T>
+	class Vector3;
+
+	template <class T>
+	class Vector4;
+
+	typedef Vector2<bool>		Vector2b;
+	typedef Vector2<int>		Vector2i;
+	typedef Vector2<float>		Vector2f;
+	typedef Vector2<double>		Vector2d;
+
+	typedef Vector3<bool>		Vector3b;
+	typedef Vector3<int>		Vector3i;
+	typedef Vector3<float>		Vector3f;
+	typedef Vector3<double>		Vector3d;
+
+	typedef Vector4<bool>		Vector4b;
+	typedef Vector4<int>		Vector4i;
+	typedef Vector4<float>		Vector4f;
+	typedef Vector4<double>		Vector4d;
+}